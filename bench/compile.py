@@ -0,0 +1,199 @@
+#!/usr/bin/env python
+"""
+Reflector: A simple struct reflection framework for C++17.
+@file Compile-time benchmark for the reflection instantiation cost.
+@author Rodrigo Siqueira <rodriados@gmail.com>
+@copyright 2024-present Rodrigo Siqueira
+"""
+import os, shlex, shutil, time
+
+from argparse import ArgumentParser
+from dataclasses import dataclass
+from typing import Callable, Optional
+
+cpp_field_types = ['int32_t', 'double', 'uint8_t', 'int64_t', 'float', 'uint16_t']
+
+# The description of a synthetic struct to be reflected over. The struct's source
+# code is generated by the given generator, which produces the struct's definition
+# and the list of its top-level member names.
+# @since 1.0
+@dataclass
+class Shape:
+    name: str
+    fields: int
+    generator: Callable[[str, int], tuple]
+
+# The result of compiling a single benchmark source file.
+# @since 1.0
+@dataclass
+class Measurement:
+    seconds: float
+    memory: int
+    success: bool
+
+# Generates a flat struct with the given number of scalar members.
+# @param name The name of the struct to be generated.
+# @param fields The number of members in the struct.
+# @return The struct definition and its member names.
+def generate_flat(name: str, fields: int) -> tuple:
+    members = [f'f{i}' for i in range(fields)]
+    body = '\n'.join(
+        f'    {cpp_field_types[i % len(cpp_field_types)]} {member};'
+        for i, member in enumerate(members))
+    return (f'struct {name} {{\n{body}\n}};\n', members)
+
+# Generates a struct composed of nested structs, each with eight scalar members.
+# @param name The name of the struct to be generated.
+# @param fields The total number of scalar members in the nested structs.
+# @return The struct definition and its member names.
+def generate_nested(name: str, fields: int) -> tuple:
+    [inner, _] = generate_flat(f'{name}_inner', 8)
+    members = [f'n{i}' for i in range(max(fields // 8, 1))]
+    body = '\n'.join(f'    {name}_inner {member};' for member in members)
+    return (f'{inner}struct {name} {{\n{body}\n}};\n', members)
+
+# Generates a struct with a few array members, whose elements sum up to the given
+# number of members, once the arrays are flattened.
+# @param name The name of the struct to be generated.
+# @param fields The total number of array elements in the struct.
+# @return The struct definition and its member names.
+def generate_arrays(name: str, fields: int) -> tuple:
+    members = [f'a{i}' for i in range(4)]
+    body = '\n'.join(
+        f'    {cpp_field_types[i]} {member}[{max(fields // 4, 1)}];'
+        for i, member in enumerate(members))
+    return (f'struct {name} {{\n{body}\n}};\n', members)
+
+# Generates the source code of a benchmark translation unit, which reflects over
+# the given struct shape, either with the loophole or with a manually provided list
+# of members, and forces the reflection to be instantiated.
+# @param shape The struct shape to be reflected over.
+# @param manual Should the struct members be manually provided?
+# @param header The library header to be included.
+# @return The benchmark source code.
+def generate_source(shape: Shape, manual: bool, header: str) -> str:
+    [definition, members] = shape.generator(shape.name, shape.fields)
+    lines = ['#include <cstdint>', f'#include <{header}>', '', definition]
+
+    if manual:
+        pointers = ', '.join(f'&{shape.name}::{member}' for member in members)
+        lines += [f'REFLECTOR_DECLARE({shape.name}, {pointers})', '']
+
+    lines += [
+        f'int main() {{'
+      , f'    {shape.name} target {{}};'
+      , f'    auto reflection = reflector::reflection_t<{shape.name}>(target);'
+      , f'    return (int) sizeof(reflection);'
+      , f'}}']
+
+    return '\n'.join(lines) + '\n'
+
+# Compiles a benchmark source file, measuring the compilation's wall-clock time and
+# its peak memory usage.
+# @param command The compilation command to be executed.
+# @return The compilation measurement.
+def measure(command: list[str]) -> Measurement:
+    start = time.perf_counter()
+    pid = os.fork()
+
+    if pid == 0:
+        devnull = os.open(os.devnull, os.O_WRONLY)
+        os.dup2(devnull, 1)
+        os.dup2(devnull, 2)
+        try: os.execvp(command[0], command)
+        finally: os._exit(127)
+
+    [_, status, usage] = os.wait4(pid, 0)
+    elapsed = time.perf_counter() - start
+
+    return Measurement(
+        seconds = elapsed
+      , memory = usage.ru_maxrss
+      , success = os.waitstatus_to_exitcode(status) == 0)
+
+# Builds the compilation command for a given compiler.
+# @param compiler The compiler to be used.
+# @param flags The flags to be passed to the compiler.
+# @param source The source file to be compiled.
+# @param output The object file to be produced.
+# @return The compilation command.
+def build_command(compiler: str, flags: list[str], source: str, output: str) -> list[str]:
+    language = ['-x', 'cu'] if os.path.basename(compiler).startswith('nvcc') else []
+    return [compiler, *language, *flags, '-c', source, '-o', output]
+
+# Formats a measurement into a table cell.
+# @param measurement The measurement to be formatted.
+# @return The formatted table cell.
+def format_measurement(measurement: Optional[Measurement]) -> str:
+    if measurement is None or not measurement.success:
+        return f'{"failed":>20}'
+    return f'{measurement.seconds:>8.2f}s {measurement.memory / 1024:>8.1f}MB'
+
+# Runs the compile-time benchmark for all struct shapes and compilers.
+# @param compilers The compilers to be benchmarked.
+# @param flags The flags to be passed to the compilers.
+# @param workdir The directory to write the generated sources to.
+# @param sizes The numbers of members of the generated structs.
+# @param header The library header to be included.
+def run_benchmark(*, compilers: list[str], flags: list[str], workdir: str, sizes: list[int], header: str) -> None:
+    shapes = [Shape(f'{kind}{size}_t', size, generator)
+        for [kind, generator] in [
+            ('flat', generate_flat)
+          , ('nested', generate_nested)
+          , ('arrays', generate_arrays)]
+        for size in sizes]
+
+    os.makedirs(workdir, exist_ok = True)
+    print(f'{"compiler":<12} {"shape":<16} {"loophole":>20} {"manual":>20}')
+
+    for compiler in compilers:
+        if shutil.which(compiler) is None:
+            print(f'{compiler:<12} skipped: compiler not found')
+            continue
+
+        for shape in shapes:
+            results = []
+
+            for manual in [False, True]:
+                source = os.path.join(workdir, f'{shape.name}-{int(manual)}.cpp')
+                output = os.path.join(workdir, f'{shape.name}-{int(manual)}.o')
+
+                with open(source, 'w') as fhandle:
+                    fhandle.write(generate_source(shape, manual, header))
+
+                results.append(measure(build_command(compiler, flags, source, output)))
+
+            print(f'{os.path.basename(compiler):<12} {shape.name:<16} '
+                f'{format_measurement(results[0])} {format_measurement(results[1])}', flush = True)
+
+if __name__ == '__main__':
+    parser = ArgumentParser(description = "Reflection compile-time benchmark")
+
+    parser.add_argument('-c', '--compilers',
+        help = 'The compilers to be benchmarked',
+        nargs = '+', metavar = 'compiler', dest = 'compilers', default = ['g++', 'clang++', 'nvcc'])
+
+    parser.add_argument('-f', '--flags',
+        help = 'The flags to be passed to the compilers',
+        metavar = 'flags', dest = 'flags', default = '-std=c++17 -Isrc')
+
+    parser.add_argument('-s', '--sizes',
+        help = 'The numbers of members of the generated structs',
+        nargs = '+', type = int, metavar = 'size', dest = 'sizes', default = [8, 64, 256, 1024])
+
+    parser.add_argument('-w', '--workdir',
+        help = 'The directory to write the generated benchmark sources to',
+        metavar = 'dir', dest = 'workdir', default = 'obj/bench')
+
+    parser.add_argument('-i', '--include',
+        help = 'The library header to be included, such as a packed distribution',
+        metavar = 'header', dest = 'header', default = 'reflector.h')
+
+    args = parser.parse_args()
+
+    run_benchmark(
+        compilers = args.compilers
+      , flags = shlex.split(args.flags)
+      , workdir = args.workdir
+      , sizes = args.sizes
+      , header = args.header)
@@ -0,0 +1,112 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Runtime microbenchmarks for the reflection access cost.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include <cstdint>
+#include <utility>
+
+#include <reflector.h>
+
+struct record_t {
+    int64_t id;
+    double price;
+    int32_t quantity;
+    int32_t flags;
+    double weights[4];
+};
+
+/**
+ * Prevents the compiler from optimizing away the computation of a value.
+ * @tparam T The type of value to be kept.
+ * @param value The value to be kept.
+ */
+template <typename T>
+inline void keep(const T& value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * Measures the average time, in nanoseconds, of visiting each record in a batch.
+ * @tparam F The type of the visiting function.
+ * @param name The name of the benchmark.
+ * @param records The batch of records to be visited.
+ * @param lambda The visiting function, which must return a value from the record.
+ */
+template <typename F>
+void benchmark(const char *name, std::vector<record_t>& records, F&& lambda)
+{
+    constexpr size_t repetitions = 50;
+    double accumulator = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    for (size_t r = 0; r < repetitions; ++r) {
+        for (auto& record : records)
+            accumulator += lambda(record);
+        keep(accumulator);
+    }
+
+    auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start);
+    std::printf("%-32s %8.3f ns/record\n", name, elapsed.count() / (repetitions * records.size()));
+}
+
+/**
+ * Sums all members of a record through a reflection tuple.
+ * @tparam R The reflection type to access members through.
+ * @tparam I The members index sequence.
+ * @param reflection The reflection to access members through.
+ * @return The sum of all members.
+ */
+template <typename R, size_t ...I>
+inline double sum(const R& reflection, std::index_sequence<I...>)
+{
+    return (double(reflection.template get<I>()) + ...);
+}
+
+/**
+ * Sums all members of a record by accessing each one of them statically.
+ * @tparam I The members index sequence.
+ * @param record The record to access members from.
+ * @return The sum of all members.
+ */
+template <size_t ...I>
+inline double access(record_t& record, std::index_sequence<I...>)
+{
+    return (double(reflector::reflection_t<record_t>::member<I>(record)) + ...);
+}
+
+int main()
+{
+    using reflection_t = reflector::reflection_t<record_t>;
+    constexpr auto members = std::make_index_sequence<reflection_t::count>();
+
+    std::vector<record_t> records (1 << 20);
+
+    for (size_t i = 0; i < records.size(); ++i)
+        records[i] = record_t {int64_t(i), i * 0.5, int32_t(i % 7), 1, {1, 2, 3, 4}};
+
+    benchmark("direct field access", records, [](const record_t& r) {
+        return double(r.id) + r.price + r.quantity + r.flags
+            + r.weights[0] + r.weights[1] + r.weights[2] + r.weights[3];
+    });
+
+    benchmark("reflection_t construction", records, [&](record_t& r) {
+        return sum(reflection_t(r), members);
+    });
+
+    benchmark("reflection_view_t construction", records, [&](record_t& r) {
+        return sum(reflector::reflection_view_t(r), members);
+    });
+
+    benchmark("reflection_t::member access", records, [&](record_t& r) {
+        return access(r, members);
+    });
+
+    return 0;
+}
@@ -9,10 +9,11 @@ import re, os
 
 from argparse import ArgumentParser
 from configparser import ConfigParser
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 from typing import TextIO
 
 cpp_preprocessor_include_regex = re.compile(rf'^#include *[<"](.*)([>"])$', re.MULTILINE)
+cpp_preprocessor_nested_include_regex = re.compile(rf'^ +#include *<(.*)>$', re.MULTILINE)
 cpp_preprocessor_pragma_once_regex = re.compile(r'^#pragma once$', re.MULTILINE)
 cpp_header_comment_regex = re.compile(r'^/\*\*.*?\*/', re.DOTALL)
 
@@ -23,14 +24,17 @@ source_cleaning_regexs = [
 ]
 
 # The information of the project to be packed. Concretely, this type informs which
-# directory the project's source code is located on, what is its namespace and which
-# file is its entrypoint.
+# directory the project's source code is located on, what is its namespace, which
+# file is its entrypoint, which language-global headers must be left out of the pack
+# and which macros must be defined before any of the project's code.
 # @since 1.0
 @dataclass
 class ProjectInfo:
     workingdir: str
     namespace: str
     entrypoint: str
+    exclude: list[str] = field(default_factory = list)
+    defines: list[str] = field(default_factory = list)
 
 # The include dependency graph for a project file. This type separates what dependencies
 # are language-globals and which are project files that must be packed.
@@ -89,6 +93,14 @@ def extract_include_dependencies(filename: str, project: ProjectInfo) -> tuple:
 
         else: language_include_files.append(match.group(1))
 
+    # Project files conditionally included are packed as well, as their contents must
+    # still be guarded by their own conditions. Conditional language-global includes,
+    # and excluded project files, are left in place instead.
+    for match in re.finditer(cpp_preprocessor_nested_include_regex, source_code):
+        if project.namespace in match.group(1) and match.group(1) not in project.exclude:
+            source_file_path = os.path.join(project.workingdir, match.group(1))
+            project_include_files.append(os.path.abspath(source_file_path))
+
     return (project_include_files, language_include_files)
 
 # Iterates over the graph and finds the required include order from the given file.
@@ -108,16 +120,38 @@ def find_graph_required_order(srcfile: str, graph: IncludeGraph) -> list[str]:
 
     return source_dependencies + [srcfile]
 
+# Replaces a conditional include of the given source file within the packed file.
+# Packed project files are removed, as their contents are already in the packed file.
+# As excluded project files are not shipped, conditionally including any of them
+# is replaced by an error, rather than by an include of a missing file.
+# @param match The conditional include match.
+# @param project The project information instance.
+# @return The replacement for the conditional include.
+def replace_nested_include(match: re.Match, project: ProjectInfo) -> str:
+    if project.namespace not in match.group(1):
+        return match.group(0)
+
+    if match.group(1) not in project.exclude:
+        return str()
+
+    indentation = match.group(0)[:match.group(0).index('#')]
+    return f'{indentation}#error "<{match.group(1)}> is not supported by this distribution"'
+
 # Copies the contents of a given source file to an output file.
 # @param srcfile The path of source file to have its contents copied.
 # @param outfhandle The target output file handle to copy source to.
-def copy_code_to_file(srcfile: str, outfhandle: TextIO) -> None:
+# @param project The project information instance.
+def copy_code_to_file(srcfile: str, outfhandle: TextIO, project: ProjectInfo) -> None:
     with open(srcfile, 'r') as fhandle:
         source_contents = fhandle.read()
 
     for regex in source_cleaning_regexs:
         source_contents = re.sub(regex, str(), source_contents)
 
+    source_contents = re.sub(cpp_preprocessor_nested_include_regex,
+        lambda match: replace_nested_include(match, project),
+        source_contents)
+
     source_contents = '\n'.join([line for line in source_contents.splitlines() if line])
 
     print(source_contents, file = outfhandle)
@@ -141,11 +175,14 @@ def write_compacted_source_code(outfile: str, graph: IncludeGraph, project: Proj
         print(f'#ifndef {namespace}_HEADER_INCLUDED', file = fhandle)
         print(f'#define {namespace}_HEADER_INCLUDED', file = fhandle)
 
-        for header in graph.language:
+        for macro in project.defines:
+            print(f'#define {macro}', file = fhandle)
+
+        for header in sorted(graph.language - set(project.exclude)):
             print(f'#include <{header}>', file = fhandle)
 
         for include_file_path in include_order:
-            copy_code_to_file(include_file_path, fhandle)
+            copy_code_to_file(include_file_path, fhandle, project)
 
         print(f'#endif //{namespace}_HEADER_INCLUDED', file = fhandle)
 
@@ -164,7 +201,9 @@ def compact_source_code(*, outfile: str, project: ProjectInfo) -> None:
       , project = ProjectInfo(
             workingdir = project.workingdir
           , namespace = project.namespace
-          , entrypoint = entrypoint_file_path))
+          , entrypoint = entrypoint_file_path
+          , exclude = project.exclude
+          , defines = project.defines))
 
 if __name__ == '__main__':
     config = ConfigParser()
@@ -186,4 +225,6 @@ if __name__ == '__main__':
         project = ProjectInfo(
             workingdir = config['project']['workingdir']
           , namespace = config['project']['namespace']
-          , entrypoint = config['project']['entrypoint']))
+          , entrypoint = config['project']['entrypoint']
+          , exclude = config['project'].get('exclude', str()).split()
+          , defines = config['project'].get('defines', str()).split()))
@@ -0,0 +1,163 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Member-wise algorithms over batches of reflected instances.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/span.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Copies the constness of a type into another one.
+     * @tparam S The type to copy constness from.
+     * @tparam T The type to copy constness into.
+     * @since 1.0
+     */
+    template <typename S, typename T>
+    using copy_const_t = std::conditional_t<std::is_const_v<S>, const T, T>;
+
+    /**
+     * Accesses a member of an instance within a batch of contiguous instances. The
+     * member is located by a constant offset and a constant stride from the batch's
+     * first byte, which allows compilers to vectorize loops over the batch.
+     * @tparam N The index of the requested member.
+     * @tparam T The reflected type of the batch's instances.
+     * @param base The batch's first byte.
+     * @param index The index of the instance to access member from.
+     * @return The requested member reference.
+     */
+    template <size_t N, typename T>
+    REFLECTOR_INLINE auto strided(copy_const_t<T, uint8_t> *base, size_t index) noexcept
+    -> copy_const_t<T, typename reflection_t<std::remove_const_t<T>>::reflection_tuple_t
+        ::template element_t<N>>&
+    {
+        using E = typename reflection_t<std::remove_const_t<T>>::reflection_tuple_t::template element_t<N>;
+        constexpr ptrdiff_t shift = reflection_t<std::remove_const_t<T>>::template offset<N>();
+        return *reinterpret_cast<copy_const_t<T, E>*>(base + shift + index * sizeof(T));
+    }
+
+    /**
+     * Applies a function to one member of every instance in a batch.
+     * @tparam N The index of the member to visit.
+     * @tparam T The reflected type of the batch's instances.
+     * @tparam F The type of function to apply to the members.
+     * @param batch The batch of instances to be visited.
+     * @param lambda The function to apply to the members.
+     */
+    template <size_t N, typename T, typename F>
+    REFLECTOR_INLINE void for_each_member(span_t<T> batch, F& lambda)
+    {
+        auto base = reinterpret_cast<copy_const_t<T, uint8_t>*>(batch.data());
+
+        for (size_t i = 0; i < batch.size(); ++i)
+            lambda(strided<N, T>(base, i));
+    }
+
+    /**
+     * Transforms one member of every instance in a batch into another batch.
+     * @tparam N The index of the member to be transformed.
+     * @tparam T The reflected type of the source batch's instances.
+     * @tparam U The reflected type of the destination batch's instances.
+     * @tparam F The type of the transformation function.
+     * @param source The batch of instances to be transformed.
+     * @param destination The batch to write the transformed members into.
+     * @param lambda The transformation function.
+     */
+    template <size_t N, typename T, typename U, typename F>
+    REFLECTOR_INLINE void transform_members(span_t<T> source, span_t<U> destination, F& lambda)
+    {
+        auto sbase = reinterpret_cast<copy_const_t<T, uint8_t>*>(source.data());
+        auto dbase = reinterpret_cast<uint8_t*>(destination.data());
+        auto count = source.size() < destination.size() ? source.size() : destination.size();
+
+        for (size_t i = 0; i < count; ++i)
+            strided<N, U>(dbase, i) = lambda(strided<N, T>(sbase, i));
+    }
+
+    /**
+     * Applies a function to each member of every instance in a batch.
+     * @tparam T The reflected type of the batch's instances.
+     * @tparam F The type of function to apply to the members.
+     * @tparam I The members index sequence.
+     * @param batch The batch of instances to be visited.
+     * @param lambda The function to apply to the members.
+     */
+    template <typename T, typename F, size_t ...I>
+    REFLECTOR_INLINE void for_each_member(span_t<T> batch, F& lambda, std::index_sequence<I...>)
+    {
+        (detail::for_each_member<I>(batch, lambda), ...);
+    }
+
+    /**
+     * Transforms each member of every instance in a batch into another batch.
+     * @tparam T The reflected type of the source batch's instances.
+     * @tparam U The reflected type of the destination batch's instances.
+     * @tparam F The type of the transformation function.
+     * @tparam I The members index sequence.
+     * @param source The batch of instances to be transformed.
+     * @param destination The batch to write the transformed members into.
+     * @param lambda The transformation function.
+     */
+    template <typename T, typename U, typename F, size_t ...I>
+    REFLECTOR_INLINE void transform_members(
+        span_t<T> source
+      , span_t<U> destination
+      , F& lambda
+      , std::index_sequence<I...>
+    ) {
+        (detail::transform_members<I>(source, destination, lambda), ...);
+    }
+}
+
+/**
+ * Applies a function to each member of every instance in a batch. The batch is
+ * iterated member by member rather than instance by instance, so that the inner
+ * loops only access a single member with a fixed stride, and can thus be vectorized.
+ * @tparam T The reflected type of the batch's instances.
+ * @tparam F The type of function to apply to the members.
+ * @param batch The batch of instances to be visited.
+ * @param lambda The function to apply to each member.
+ */
+template <typename T, typename F>
+REFLECTOR_INLINE void for_each_member(span_t<T> batch, F&& lambda)
+{
+    constexpr size_t count = reflection_t<std::remove_const_t<T>>::count;
+    detail::for_each_member(batch, lambda, std::make_index_sequence<count>());
+}
+
+/**
+ * Transforms each member of every instance in a batch into the corresponding member
+ * of the instances of another batch. Members are transformed one at a time over the
+ * whole batch, so that the inner loops can be vectorized.
+ * @tparam T The reflected type of the source batch's instances.
+ * @tparam U The reflected type of the destination batch's instances.
+ * @tparam F The type of the transformation function.
+ * @param source The batch of instances to be transformed.
+ * @param destination The batch to write the transformed members into.
+ * @param lambda The transformation function.
+ */
+template <typename T, typename U, typename F>
+REFLECTOR_INLINE void transform_members(span_t<T> source, span_t<U> destination, F&& lambda)
+{
+    constexpr size_t count = reflection_t<std::remove_const_t<T>>::count;
+
+    static_assert(
+        count == reflection_t<U>::count
+      , "transformed types must have the same number of members");
+
+    detail::transform_members(source, destination, lambda, std::make_index_sequence<count>());
+}
+
+REFLECTOR_END_NAMESPACE
@@ -9,10 +9,6 @@
 #ifndef REFLECTOR_HEADER_INCLUDED
 #define REFLECTOR_HEADER_INCLUDED
 
-#include <reflector/version.h>
-#include <reflector/environment.h>
-
-#include <reflector/provider.hpp>
-#include <reflector/reflector.hpp>
+#include <reflector/core.h>
 
 #endif
@@ -0,0 +1,330 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The columnar export of reflected types through the Arrow C data interface.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/names.hpp>
+#include <reflector/span.hpp>
+#include <reflector/soa.hpp>
+
+/*
+ * The structures of the Arrow C data interface. These are defined by the interface's
+ * specification to be copied verbatim into any producer or consumer, and are guarded
+ * so that they do not clash with the definitions of Arrow itself, if included.
+ * @see https://arrow.apache.org/docs/format/CDataInterface.html
+ */
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+extern "C" {
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+}
+
+#endif
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Produces the Arrow format string of a member type.
+     * @tparam R The member type to be exported.
+     * @return The member type's Arrow format string.
+     */
+    template <typename R>
+    REFLECTOR_CONSTEXPR const char *arrow_format() noexcept
+    {
+        if constexpr (std::is_enum_v<R>) {
+            return arrow_format<std::underlying_type_t<R>>();
+        } else if constexpr (std::is_integral_v<R> && !std::is_same_v<R, bool>) {
+            constexpr bool s = std::is_signed_v<R>;
+            if constexpr (sizeof(R) == 1) return s ? "c" : "C";
+            if constexpr (sizeof(R) == 2) return s ? "s" : "S";
+            if constexpr (sizeof(R) == 4) return s ? "i" : "I";
+            if constexpr (sizeof(R) == 8) return s ? "l" : "L";
+        } else if constexpr (std::is_same_v<R, float>) {
+            return "f";
+        } else if constexpr (std::is_same_v<R, double>) {
+            return "g";
+        } else {
+            static_assert(!sizeof(R), "the member type has no Arrow equivalent");
+        }
+    }
+
+    /**
+     * Names a member of a reflected type for its export. When member names are known,
+     * they are used, with the elements of array members suffixed by their index.
+     * Otherwise, members are named by their index.
+     * @tparam T The reflected type to be exported.
+     * @param index The index of the member to be named.
+     * @return The member's name.
+     */
+    template <typename T>
+    REFLECTOR_INLINE std::string arrow_name(size_t index)
+    {
+        if constexpr (has_member_names_v<T>) {
+            using descriptor_t = typename reflection_t<T>::descriptor_t;
+            const size_t member = descriptor_t::member_of[index];
+            const size_t first = descriptor_t::first_of[member];
+            const bool array = first != index
+                || (index + 1 < descriptor_t::count && descriptor_t::member_of[index + 1] == member);
+            std::string name (member_name<T>(index));
+            return array ? name + "[" + std::to_string(index - first) + "]" : name;
+        } else {
+            return "f" + std::to_string(index);
+        }
+    }
+
+    /**
+     * Drops a reference to the resources shared by an exported structure and its
+     * children. As a consumer may move children out of their parent and release each
+     * of them independently, the resources are only freed by the last release.
+     * @tparam S The shared resources type.
+     * @param self The shared resources to drop a reference to.
+     */
+    template <typename S>
+    REFLECTOR_INLINE void arrow_unref(S *self) noexcept
+    {
+        if (self->references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            delete self;
+    }
+
+    /**
+     * Keeps the resources of an exported schema alive until it and all of its children
+     * are released.
+     * @tparam N The number of exported columns.
+     * @since 1.0
+     */
+    template <size_t N>
+    struct arrow_schema_t
+    {
+        std::array<std::string, N> names;
+        std::array<ArrowSchema, N> children;
+        std::array<ArrowSchema*, N> pointers;
+        std::atomic<size_t> references {N + 1};
+
+        /**
+         * Releases an exported child schema. Its resources are shared with its parent
+         * schema, and are freed if it is the last one to be released.
+         * @param schema The child schema to be released.
+         */
+        static void release_child(ArrowSchema *schema) noexcept
+        {
+            arrow_unref(static_cast<arrow_schema_t*>(schema->private_data));
+            schema->release = nullptr;
+        }
+
+        /**
+         * Releases an exported schema, along with the children still owned by it. The
+         * resources are freed once all children moved out of it are released as well.
+         * @param schema The schema to be released.
+         */
+        static void release(ArrowSchema *schema) noexcept
+        {
+            auto self = static_cast<arrow_schema_t*>(schema->private_data);
+
+            for (ArrowSchema *child : self->pointers)
+                if (child->release) child->release(child);
+
+            arrow_unref(self);
+            schema->release = nullptr;
+        }
+    };
+
+    /**
+     * Keeps the resources of an exported array alive until it and all of its children
+     * are released. The exported container is owned by the array, so that its columns
+     * are never copied.
+     * @tparam T The reflected type to be exported.
+     * @since 1.0
+     */
+    template <typename T>
+    struct arrow_array_t
+    {
+        static constexpr size_t count = soa_vector_t<T>::count;
+
+        soa_vector_t<T> data;
+        std::array<ArrowArray, count> children;
+        std::array<ArrowArray*, count> pointers;
+        std::array<std::array<const void*, 2>, count> buffers;
+        const void *validity[1] = {nullptr};
+        std::atomic<size_t> references {count + 1};
+
+        /**
+         * Releases an exported child array. Its resources are shared with its parent
+         * array, and are freed if it is the last one to be released.
+         * @param array The child array to be released.
+         */
+        static void release_child(ArrowArray *array) noexcept
+        {
+            arrow_unref(static_cast<arrow_array_t*>(array->private_data));
+            array->release = nullptr;
+        }
+
+        /**
+         * Releases an exported array, along with the children still owned by it. The
+         * resources are freed once all children moved out of it are released as well.
+         * @param array The array to be released.
+         */
+        static void release(ArrowArray *array) noexcept
+        {
+            auto self = static_cast<arrow_array_t*>(array->private_data);
+
+            for (ArrowArray *child : self->pointers)
+                if (child->release) child->release(child);
+
+            arrow_unref(self);
+            array->release = nullptr;
+        }
+    };
+
+    /**
+     * Fills the exported child schemas of a reflected type's members.
+     * @tparam T The reflected type to be exported.
+     * @tparam I The members index sequence.
+     * @param self The exported schema's resources.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE void export_schema(
+        arrow_schema_t<sizeof...(I)>& self
+      , std::index_sequence<I...>
+    ) {
+        using reflection_tuple_t = typename reflection_t<T>::reflection_tuple_t;
+        using schema_t = arrow_schema_t<sizeof...(I)>;
+
+        ((self.names[I] = arrow_name<T>(I)), ...);
+        ((self.children[I] = ArrowSchema {
+            arrow_format<typename reflection_tuple_t::template element_t<I>>()
+          , self.names[I].c_str(), nullptr, 0, 0, nullptr, nullptr
+          , &schema_t::release_child, &self
+        }), ...);
+        ((self.pointers[I] = &self.children[I]), ...);
+    }
+
+    /**
+     * Fills the exported child arrays with the container's columns.
+     * @tparam T The reflected type to be exported.
+     * @tparam I The members index sequence.
+     * @param self The exported array's resources.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE void export_array(arrow_array_t<T>& self, std::index_sequence<I...>)
+    {
+        const auto length = static_cast<int64_t>(self.data.size());
+
+        ((self.buffers[I] = {nullptr, self.data.template column<I>().data()}), ...);
+        ((self.children[I] = ArrowArray {
+            length, 0, 0, 2, 0, self.buffers[I].data(), nullptr, nullptr
+          , &arrow_array_t<T>::release_child, &self
+        }), ...);
+        ((self.pointers[I] = &self.children[I]), ...);
+    }
+}
+
+/**
+ * Exports the schema of a reflected type through the Arrow C data interface. The
+ * schema is a struct with one child for each property member of the reflected type.
+ * The exported schema must be released by its consumer.
+ * @tparam T The reflected type to have its schema exported.
+ * @param schema The schema structure to be filled.
+ */
+template <typename T>
+REFLECTOR_INLINE void export_schema(ArrowSchema *schema)
+{
+    constexpr size_t count = reflection_t<T>::count;
+    auto self = new detail::arrow_schema_t<count>;
+
+    detail::export_schema<T>(*self, std::make_index_sequence<count>());
+
+    *schema = ArrowSchema {
+        "+s", "", nullptr, 0, static_cast<int64_t>(count), self->pointers.data()
+      , nullptr, &detail::arrow_schema_t<count>::release, self
+    };
+}
+
+/**
+ * Exports a struct-of-arrays container through the Arrow C data interface. As each
+ * member column is already contiguous and without any padding among its values,
+ * the container's columns are handed over as the exported buffers without being
+ * copied. The exported array takes ownership of the container and must be released
+ * by its consumer.
+ * @tparam T The reflected type to be exported.
+ * @param data The container to be exported.
+ * @param array The array structure to be filled.
+ */
+template <typename T>
+REFLECTOR_INLINE void export_array(soa_vector_t<T>&& data, ArrowArray *array)
+{
+    using array_t = detail::arrow_array_t<T>;
+    auto self = new array_t;
+    self->data = std::move(data);
+
+    detail::export_array(*self, std::make_index_sequence<array_t::count>());
+
+    *array = ArrowArray {
+        static_cast<int64_t>(self->data.size()), 0, 0, 1, static_cast<int64_t>(array_t::count)
+      , self->validity, self->pointers.data(), nullptr, &array_t::release, self
+    };
+}
+
+/**
+ * Exports a contiguous sequence of reflected instances through the Arrow C data
+ * interface. The instances are transposed into columns, which are then exported.
+ * @tparam T The reflected type to be exported.
+ * @param data The instances to be exported.
+ * @param array The array structure to be filled.
+ */
+template <typename T>
+REFLECTOR_INLINE void export_array(span_t<const T> data, ArrowArray *array)
+{
+    soa_vector_t<T> columns;
+    columns.reserve(data.size());
+
+    for (const T& value : data)
+        columns.push_back(value);
+
+    export_array(std::move(columns), array);
+}
+
+REFLECTOR_END_NAMESPACE
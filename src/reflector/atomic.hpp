@@ -0,0 +1,350 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Atomic access to the members of shared reflected instances.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+
+/*
+ * Decides whether members are atomically accessed through the standard atomic
+ * references, only available from C++20 on, or through the compiler's builtins.
+ * Both are interchangeable, and neither requires changing the reflected type.
+ */
+#if !defined(REFLECTOR_ATOMIC_REF)
+  #if REFLECTOR_CPP_DIALECT >= 2020 && defined(__cpp_lib_atomic_ref)
+    #define REFLECTOR_ATOMIC_REF 1
+  #else
+    #define REFLECTOR_ATOMIC_REF 0
+  #endif
+#endif
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+#if !REFLECTOR_ATOMIC_REF
+    /**
+     * Converts a standard memory order into the compiler's builtin memory order.
+     * @param order The standard memory order to be converted.
+     * @return The corresponding builtin memory order.
+     */
+    REFLECTOR_CONSTEXPR int builtin_order(std::memory_order order) noexcept
+    {
+        switch (order) {
+            case std::memory_order_relaxed: return __ATOMIC_RELAXED;
+            case std::memory_order_consume: return __ATOMIC_CONSUME;
+            case std::memory_order_acquire: return __ATOMIC_ACQUIRE;
+            case std::memory_order_release: return __ATOMIC_RELEASE;
+            case std::memory_order_acq_rel: return __ATOMIC_ACQ_REL;
+            default:                        return __ATOMIC_SEQ_CST;
+        }
+    }
+#endif
+
+    /**
+     * Atomically accesses a member of a shared instance, in place. The member must be
+     * suitably aligned and small enough for its accesses to be lock-free.
+     * @tparam E The member type.
+     * @since 1.0
+     */
+    template <typename E>
+    struct atomic_member_t
+    {
+        static_assert(std::is_trivially_copyable_v<E>, "atomic members must be trivially copyable");
+
+      #if REFLECTOR_ATOMIC_REF
+        static_assert(
+            alignof(E) >= std::atomic_ref<E>::required_alignment
+          , "member is not suitably aligned for atomic access");
+      #else
+        static_assert(
+            alignof(E) >= sizeof(E) && __atomic_always_lock_free(sizeof(E), 0)
+          , "member cannot be atomically accessed without locks");
+      #endif
+
+        /**
+         * Atomically loads the member's value.
+         * @param target The member to be loaded.
+         * @param order The memory order of the load.
+         * @return The loaded value.
+         */
+        REFLECTOR_INLINE static E load(E& target, std::memory_order order) noexcept
+        {
+          #if REFLECTOR_ATOMIC_REF
+            return std::atomic_ref<E>(target).load(order);
+          #else
+            E result;
+            __atomic_load(&target, &result, builtin_order(order));
+            return result;
+          #endif
+        }
+
+        /**
+         * Atomically stores a value into the member.
+         * @param target The member to be stored into.
+         * @param value The value to be stored.
+         * @param order The memory order of the store.
+         */
+        REFLECTOR_INLINE static void store(E& target, E value, std::memory_order order) noexcept
+        {
+          #if REFLECTOR_ATOMIC_REF
+            std::atomic_ref<E>(target).store(value, order);
+          #else
+            __atomic_store(&target, &value, builtin_order(order));
+          #endif
+        }
+
+        /**
+         * Atomically replaces the member's value.
+         * @param target The member to be replaced.
+         * @param value The value to replace the member with.
+         * @param order The memory order of the operation.
+         * @return The member's previous value.
+         */
+        REFLECTOR_INLINE static E exchange(E& target, E value, std::memory_order order) noexcept
+        {
+          #if REFLECTOR_ATOMIC_REF
+            return std::atomic_ref<E>(target).exchange(value, order);
+          #else
+            E result;
+            __atomic_exchange(&target, &value, &result, builtin_order(order));
+            return result;
+          #endif
+        }
+
+        /**
+         * Atomically adds a value to an integral member.
+         * @param target The member to be added to.
+         * @param value The value to be added.
+         * @param order The memory order of the operation.
+         * @return The member's previous value.
+         */
+        REFLECTOR_INLINE static E fetch_add(E& target, E value, std::memory_order order) noexcept
+        {
+            static_assert(std::is_integral_v<E>, "only integral members can be atomically added to");
+          #if REFLECTOR_ATOMIC_REF
+            return std::atomic_ref<E>(target).fetch_add(value, order);
+          #else
+            return __atomic_fetch_add(&target, value, builtin_order(order));
+          #endif
+        }
+    };
+
+    /**
+     * Finds the memory order to be used by the fence of a bulk load operation.
+     * @param order The memory order requested for the bulk operation.
+     * @return The fence memory order.
+     */
+    REFLECTOR_CONSTEXPR std::memory_order load_fence(std::memory_order order) noexcept
+    {
+        return order == std::memory_order_seq_cst ? order : std::memory_order_acquire;
+    }
+
+    /**
+     * Finds the memory order to be used by the fence of a bulk store operation.
+     * @param order The memory order requested for the bulk operation.
+     * @return The fence memory order.
+     */
+    REFLECTOR_CONSTEXPR std::memory_order store_fence(std::memory_order order) noexcept
+    {
+        return order == std::memory_order_seq_cst ? order : std::memory_order_release;
+    }
+}
+
+/**
+ * Exposes each member of a shared instance of a reflected type for atomic access.
+ * Members are accessed in place, so that the reflected type's layout need not be
+ * changed by wrapping its members within atomic types.
+ * @tparam T The reflected type to be accessed.
+ * @since 1.0
+ */
+template <typename T>
+class atomic_view_t
+{
+    static_assert(!std::is_const_v<T>, "atomic views require mutable instances");
+
+    public:
+        typedef T target_t;
+
+    private:
+        typedef reflection_t<T> underlying_t;
+
+    public:
+        using reflection_tuple_t = typename underlying_t::reflection_tuple_t;
+
+        /**
+         * The type of one of the viewed instance's members.
+         * @tparam N The index of the requested member.
+         * @since 1.0
+         */
+        template <size_t N>
+        using element_t = typename reflection_tuple_t::template element_t<N>;
+
+    public:
+        static constexpr size_t count = reflection_tuple_t::count;
+
+    private:
+        T *m_target;
+
+    public:
+        REFLECTOR_INLINE atomic_view_t() noexcept = delete;
+        REFLECTOR_INLINE atomic_view_t(const atomic_view_t&) noexcept = default;
+        REFLECTOR_INLINE atomic_view_t(atomic_view_t&&) noexcept = default;
+
+        /**
+         * Creates an atomic view over a shared instance.
+         * @param target The shared instance to be viewed.
+         */
+        REFLECTOR_INLINE atomic_view_t(T& target) noexcept
+          : m_target (&target)
+        {}
+
+        REFLECTOR_INLINE atomic_view_t& operator=(const atomic_view_t&) noexcept = default;
+        REFLECTOR_INLINE atomic_view_t& operator=(atomic_view_t&&) noexcept = default;
+
+        /**
+         * Atomically loads a member of the viewed instance.
+         * @tparam N The index of the member to be loaded.
+         * @param order The memory order of the load.
+         * @return The member's value.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE element_t<N> load(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            return detail::atomic_member_t<element_t<N>>::load(member<N>(), order);
+        }
+
+        /**
+         * Atomically stores a value into a member of the viewed instance.
+         * @tparam N The index of the member to be stored into.
+         * @param value The value to be stored.
+         * @param order The memory order of the store.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE void store(
+            element_t<N> value
+          , std::memory_order order = std::memory_order_seq_cst
+        ) const noexcept {
+            detail::atomic_member_t<element_t<N>>::store(member<N>(), value, order);
+        }
+
+        /**
+         * Atomically replaces a member of the viewed instance.
+         * @tparam N The index of the member to be replaced.
+         * @param value The value to replace the member with.
+         * @param order The memory order of the operation.
+         * @return The member's previous value.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE element_t<N> exchange(
+            element_t<N> value
+          , std::memory_order order = std::memory_order_seq_cst
+        ) const noexcept {
+            return detail::atomic_member_t<element_t<N>>::exchange(member<N>(), value, order);
+        }
+
+        /**
+         * Atomically adds a value to an integral member of the viewed instance.
+         * @tparam N The index of the member to be added to.
+         * @param value The value to be added.
+         * @param order The memory order of the operation.
+         * @return The member's previous value.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE element_t<N> fetch_add(
+            element_t<N> value
+          , std::memory_order order = std::memory_order_seq_cst
+        ) const noexcept {
+            return detail::atomic_member_t<element_t<N>>::fetch_add(member<N>(), value, order);
+        }
+
+        /**
+         * Loads all members of the viewed instance. Each member is loaded atomically,
+         * but the instance as a whole is not, so members may be observed from distinct
+         * writes. Rather than ordering each load, members are loaded with relaxed order
+         * and followed by a single fence, if any ordering has been requested.
+         * @param order The memory order of the bulk load.
+         * @return A copy of the viewed instance.
+         */
+        REFLECTOR_INLINE T load_all(std::memory_order order = std::memory_order_seq_cst) const noexcept
+        {
+            T result;
+            load_all(result, std::make_index_sequence<count>());
+
+            if (order != std::memory_order_relaxed)
+                std::atomic_thread_fence(detail::load_fence(order));
+
+            return result;
+        }
+
+        /**
+         * Stores all members into the viewed instance. Each member is stored atomically,
+         * but the instance as a whole is not. A single fence precedes the stores, which
+         * are themselves relaxed, if any ordering has been requested.
+         * @param value The instance to be stored.
+         * @param order The memory order of the bulk store.
+         */
+        REFLECTOR_INLINE void store_all(
+            const T& value
+          , std::memory_order order = std::memory_order_seq_cst
+        ) const noexcept {
+            if (order != std::memory_order_relaxed)
+                std::atomic_thread_fence(detail::store_fence(order));
+
+            store_all(value, std::make_index_sequence<count>());
+        }
+
+        /**
+         * Retrieves the viewed instance.
+         * @return The viewed instance.
+         */
+        REFLECTOR_INLINE T& target() const noexcept
+        {
+            return *m_target;
+        }
+
+    private:
+        /**
+         * Retrieves a reference to a member of the viewed instance.
+         * @tparam N The index of the requested member.
+         * @return The member reference.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE element_t<N>& member() const noexcept
+        {
+            return underlying_t::template member<N>(*m_target);
+        }
+
+        /**
+         * Loads all members of the viewed instance with relaxed order.
+         * @tparam I The members index sequence.
+         * @param result The instance to load members into.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE void load_all(T& result, std::index_sequence<I...>) const noexcept
+        {
+            ((underlying_t::template member<I>(result) = load<I>(std::memory_order_relaxed)), ...);
+        }
+
+        /**
+         * Stores all members into the viewed instance with relaxed order.
+         * @tparam I The members index sequence.
+         * @param value The instance to store members from.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE void store_all(const T& value, std::index_sequence<I...>) const noexcept
+        {
+            (store<I>(underlying_t::template member<I>(value), std::memory_order_relaxed), ...);
+        }
+};
+
+REFLECTOR_END_NAMESPACE
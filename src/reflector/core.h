@@ -0,0 +1,15 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The project's core API exposition header file.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <reflector/version.h>
+#include <reflector/environment.h>
+
+#include <reflector/provider.hpp>
+#include <reflector/reflector.hpp>
+#include <reflector/view.hpp>
+#include <reflector/span.hpp>
@@ -0,0 +1,285 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Struct-of-arrays staging of reflected types into CUDA device memory.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <cuda_runtime.h>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/span.hpp>
+#include <reflector/soa.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * A non-owning handle to the columns of reflected instances stored in device memory
+ * in a struct-of-arrays layout. The handle can be passed by value to kernels, so that
+ * consecutive threads accessing a member of consecutive instances issue coalesced
+ * memory loads and stores.
+ * @tparam T The reflected type stored in device memory.
+ * @since 1.0
+ */
+template <typename T>
+class device_columns_t
+{
+    template <typename> friend class device_soa_t;
+
+    public:
+        typedef T target_t;
+
+    public:
+        using reflection_tuple_t = typename reflection_t<T>::reflection_tuple_t;
+
+        /**
+         * The type of the elements stored in one of the device columns.
+         * @tparam N The index of the requested column.
+         * @since 1.0
+         */
+        template <size_t N>
+        using element_t = typename reflection_tuple_t::template element_t<N>;
+
+    public:
+        static constexpr size_t count = reflection_tuple_t::count;
+
+    private:
+        void *m_columns[count] = {};
+        size_t m_size = 0;
+
+    public:
+        /**
+         * Accesses a member of an instance stored in device memory.
+         * @tparam N The index of the requested member column.
+         * @param index The index of the requested instance.
+         * @return The requested member reference.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE auto get(size_t index) const noexcept -> element_t<N>&
+        {
+            return static_cast<element_t<N>*>(m_columns[N])[index];
+        }
+
+        /**
+         * Retrieves a view over all values of a member within device memory.
+         * @tparam N The index of the requested member column.
+         * @return The device member column view.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE auto column() const noexcept -> span_t<element_t<N>>
+        {
+            return span_t(static_cast<element_t<N>*>(m_columns[N]), m_size);
+        }
+
+        /**
+         * Informs the number of instances stored in device memory.
+         * @return The number of instances in the device columns.
+         */
+        REFLECTOR_INLINE size_t size() const noexcept
+        {
+            return m_size;
+        }
+};
+
+/**
+ * Stores instances of a reflected type in device memory in a struct-of-arrays layout.
+ * Instances are transposed into columns on the host, from the reflected type's layout,
+ * and each column is transferred to or from the device with a single contiguous copy.
+ * As it manages device memory through the CUDA runtime, this type is host-only.
+ * @tparam T The reflected type to be stored in device memory.
+ * @since 1.0
+ */
+template <typename T>
+class device_soa_t
+{
+    public:
+        typedef T target_t;
+
+    public:
+        static constexpr size_t count = reflection_t<T>::count;
+
+    private:
+        device_columns_t<T> m_device;
+        soa_vector_t<T> m_staging;
+
+    public:
+        inline device_soa_t() noexcept = default;
+        inline device_soa_t(const device_soa_t&) = delete;
+
+        /**
+         * Acquires the device memory owned by another instance.
+         * @param other The instance to acquire device memory from.
+         */
+        inline device_soa_t(device_soa_t&& other) noexcept
+          : m_device (std::exchange(other.m_device, device_columns_t<T>()))
+          , m_staging (std::move(other.m_staging))
+        {}
+
+        /**
+         * Releases the device memory owned by the instance.
+         */
+        inline ~device_soa_t()
+        {
+            release();
+        }
+
+        inline device_soa_t& operator=(const device_soa_t&) = delete;
+
+        /**
+         * Acquires the device memory owned by another instance.
+         * @param other The instance to acquire device memory from.
+         * @return The current instance.
+         */
+        inline device_soa_t& operator=(device_soa_t&& other) noexcept
+        {
+            release();
+            m_device = std::exchange(other.m_device, device_columns_t<T>());
+            m_staging = std::move(other.m_staging);
+            return *this;
+        }
+
+        /**
+         * Transposes instances into columns and copies them into device memory. The
+         * device memory is reallocated whenever the number of instances changes.
+         * @param source The instances to be copied into device memory.
+         * @return The CUDA error status of the operation.
+         */
+        inline cudaError_t upload(span_t<const T> source)
+        {
+            if (cudaError_t error = allocate(source.size()); error != cudaSuccess)
+                return error;
+
+            m_staging.clear();
+            m_staging.reserve(source.size());
+
+            for (const T& value : source)
+                m_staging.push_back(value);
+
+            return upload(std::make_index_sequence<count>());
+        }
+
+        /**
+         * Copies the columns from device memory and transposes them into instances.
+         * @param target The instances to be written with the device memory contents.
+         * @return The CUDA error status of the operation.
+         */
+        inline cudaError_t download(span_t<T> target)
+        {
+            m_staging.resize(m_device.size());
+
+            if (cudaError_t error = download(std::make_index_sequence<count>()); error != cudaSuccess)
+                return error;
+
+            scatter(target, std::make_index_sequence<count>());
+            return cudaSuccess;
+        }
+
+        /**
+         * Retrieves the handle to the device columns, which can be passed to kernels.
+         * @return The device columns handle.
+         */
+        inline const device_columns_t<T>& columns() const noexcept
+        {
+            return m_device;
+        }
+
+        /**
+         * Informs the number of instances currently stored in device memory.
+         * @return The number of instances in device memory.
+         */
+        inline size_t size() const noexcept
+        {
+            return m_device.size();
+        }
+
+    private:
+        /**
+         * Allocates device memory for the given number of instances in each column.
+         * @param size The number of instances to allocate device memory for.
+         * @return The CUDA error status of the operation.
+         */
+        inline cudaError_t allocate(size_t size)
+        {
+            if (size == m_device.size())
+                return cudaSuccess;
+
+            release();
+
+            for (size_t i = 0; i < count; ++i) {
+                size_t bytes = size * reflection_t<T>::descriptor_t::sizes[i];
+                if (cudaError_t error = cudaMalloc(&m_device.m_columns[i], bytes); error != cudaSuccess) {
+                    release();
+                    return error;
+                }
+            }
+
+            m_device.m_size = size;
+            return cudaSuccess;
+        }
+
+        /**
+         * Releases all device memory owned by the instance.
+         */
+        inline void release() noexcept
+        {
+            for (void *&column : m_device.m_columns)
+                if (column != nullptr) cudaFree(std::exchange(column, nullptr));
+            m_device.m_size = 0;
+        }
+
+        /**
+         * Copies each transposed column from the host into device memory.
+         * @tparam I The columns index sequence.
+         * @return The CUDA error status of the operation.
+         */
+        template <size_t ...I>
+        inline cudaError_t upload(std::index_sequence<I...>)
+        {
+            cudaError_t error = cudaSuccess;
+
+            ((error = error != cudaSuccess ? error : cudaMemcpy(
+                m_device.m_columns[I], m_staging.template column<I>().data()
+              , m_device.size() * sizeof(typename device_columns_t<T>::template element_t<I>)
+              , cudaMemcpyHostToDevice)), ...);
+
+            return error;
+        }
+
+        /**
+         * Copies each column from device memory into the host staging columns.
+         * @tparam I The columns index sequence.
+         * @return The CUDA error status of the operation.
+         */
+        template <size_t ...I>
+        inline cudaError_t download(std::index_sequence<I...>)
+        {
+            cudaError_t error = cudaSuccess;
+
+            ((error = error != cudaSuccess ? error : cudaMemcpy(
+                m_staging.template column<I>().data(), m_device.m_columns[I]
+              , m_device.size() * sizeof(typename device_columns_t<T>::template element_t<I>)
+              , cudaMemcpyDeviceToHost)), ...);
+
+            return error;
+        }
+
+        /**
+         * Transposes the host staging columns back into instances.
+         * @tparam I The columns index sequence.
+         * @param target The instances to be written with the columns' contents.
+         */
+        template <size_t ...I>
+        inline void scatter(span_t<T> target, std::index_sequence<I...>)
+        {
+            size_t size = target.size() < m_staging.size() ? target.size() : m_staging.size();
+
+            for (size_t i = 0; i < size; ++i)
+                ((reflection_t<T>::template member<I>(target[i]) = m_staging.template column<I>()[i]), ...);
+        }
+};
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,297 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Member-wise difference and partial copy of reflected instances.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/flat.hpp>
+#include <reflector/detail/layout.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * The mask of members of a reflected type, with one bit for each of its members.
+ * @tparam T The reflected type to have its members masked.
+ * @since 1.0
+ */
+template <typename T>
+using member_mask_t = std::bitset<reflection_t<T>::count>;
+
+namespace detail
+{
+    /**
+     * Finds the index of the first member of each contiguous run of members in a
+     * type layout. The last element is the total number of members in the type.
+     * @tparam M The number of contiguous runs in the type layout.
+     * @tparam N The number of members in the type layout.
+     * @param sizes The sizes of each member.
+     * @param offsets The offsets of each member.
+     * @return The index of the first member of each run.
+     */
+    template <size_t M, size_t N>
+    REFLECTOR_CONSTEXPR auto heads(
+        const std::array<size_t, N>& sizes
+      , const std::array<size_t, N>& offsets
+    ) noexcept -> std::array<size_t, M + 1>
+    {
+        std::array<size_t, M + 1> result {};
+
+        for (size_t i = 0, j = 0; i < N; ++i)
+            if (i == 0 || offsets[i] != offsets[i - 1] + sizes[i - 1])
+                result[j++] = i;
+
+        result[M] = N;
+        return result;
+    }
+
+    /**
+     * The index of the first member of each contiguous run of a reflected type.
+     * @tparam T The reflected type to be inspected.
+     * @since 1.0
+     */
+    template <typename T, typename D = typename reflection_t<T>::descriptor_t>
+    inline constexpr auto heads_v = heads<D::runs.size()>(D::sizes, D::offsets);
+
+    /**
+     * Checks whether a member type has padding bytes within its own storage. These
+     * bytes might hold any values, and thus must be skipped when comparing members.
+     * @tparam R The member type to be checked.
+     * @since 1.0
+     */
+    template <typename R, bool = nested_v<R>>
+    inline constexpr bool padded_v = false;
+
+    template <typename R>
+    inline constexpr bool padded_v<R, true> = flat_descriptor_t<R>::has_padding;
+
+    /**
+     * Compares the contiguous runs of leaves of two nested member values.
+     * @tparam R The member type to be compared.
+     * @tparam J The leaf runs index sequence.
+     * @param a The first member's bytes.
+     * @param b The second member's bytes.
+     * @return Are the members' leaves equal?
+     */
+    template <typename R, size_t ...J>
+    REFLECTOR_INLINE bool same(const uint8_t *a, const uint8_t *b, std::index_sequence<J...>) noexcept
+    {
+        constexpr auto& runs = flat_descriptor_t<R>::runs;
+        return ((std::memcmp(a + runs[J].offset, b + runs[J].offset, runs[J].length) == 0) && ...);
+    }
+
+    /**
+     * Compares two member values by their bytes. Members with padding bytes within
+     * their own storage are compared leaf by leaf, so that their padding is skipped.
+     * @tparam R The member type to be compared.
+     * @param a The first member's bytes.
+     * @param b The second member's bytes.
+     * @return Are the members equal?
+     */
+    template <typename R>
+    REFLECTOR_INLINE bool same(const uint8_t *a, const uint8_t *b) noexcept
+    {
+        if constexpr (padded_v<R>) {
+            constexpr size_t runs = flat_descriptor_t<R>::runs.size();
+            return same<R>(a, b, std::make_index_sequence<runs>());
+        } else {
+            return std::memcmp(a, b, sizeof(R)) == 0;
+        }
+    }
+
+    /**
+     * Compares a single member of two reflected instances.
+     * @tparam T The reflected type to be compared.
+     * @tparam N The index of the member to be compared.
+     * @param a The first instance's bytes.
+     * @param b The second instance's bytes.
+     * @param mask The mask to set the member's bit on if it differs.
+     */
+    template <typename T, size_t N>
+    REFLECTOR_INLINE void compare(const uint8_t *a, const uint8_t *b, member_mask_t<T>& mask) noexcept
+    {
+        using E = typename reflection_t<T>::reflection_tuple_t::template element_t<N>;
+        constexpr size_t offset = reflection_t<T>::descriptor_t::offsets[N];
+
+        if (!same<E>(a + offset, b + offset))
+            mask.set(N);
+    }
+
+    /**
+     * Compares the members of a contiguous run of two reflected instances one by one.
+     * @tparam T The reflected type to be compared.
+     * @tparam F The index of the run's first member.
+     * @tparam I The run's members index sequence.
+     * @param a The first instance's bytes.
+     * @param b The second instance's bytes.
+     * @param mask The mask to set the different members' bits on.
+     */
+    template <typename T, size_t F, size_t ...I>
+    REFLECTOR_INLINE void diff(
+        const uint8_t *a
+      , const uint8_t *b
+      , member_mask_t<T>& mask
+      , std::index_sequence<I...>
+    ) noexcept {
+        (compare<T, F + I>(a, b, mask), ...);
+    }
+
+    /**
+     * Checks whether any member of a contiguous run has padding within its storage.
+     * @tparam T The reflected type to be inspected.
+     * @tparam F The index of the run's first member.
+     * @tparam I The run's members index sequence.
+     * @return Does any member of the run have padding bytes?
+     */
+    template <typename T, size_t F, size_t ...I>
+    REFLECTOR_CONSTEXPR bool padded(std::index_sequence<I...>) noexcept
+    {
+        using reflection_tuple_t = typename reflection_t<T>::reflection_tuple_t;
+        return (padded_v<typename reflection_tuple_t::template element_t<F + I>> || ...);
+    }
+
+    /**
+     * Compares the members of a contiguous run of two reflected instances. The whole
+     * run is compared at once, and members are only compared individually when the
+     * run is found to be different. Runs holding members with padding bytes within
+     * their own storage cannot be compared at once, and are always compared member
+     * by member instead.
+     * @tparam T The reflected type to be compared.
+     * @tparam J The index of the run to be compared.
+     * @param a The first instance's bytes.
+     * @param b The second instance's bytes.
+     * @param mask The mask to set the different members' bits on.
+     */
+    template <typename T, size_t J>
+    REFLECTOR_INLINE void diff(const uint8_t *a, const uint8_t *b, member_mask_t<T>& mask) noexcept
+    {
+        using descriptor_t = typename reflection_t<T>::descriptor_t;
+        constexpr auto run = descriptor_t::runs[J];
+        constexpr size_t first = heads_v<T>[J], last = heads_v<T>[J + 1];
+        constexpr auto members = std::make_index_sequence<last - first>();
+
+        if constexpr (!padded<T, first>(members)) {
+            if (std::memcmp(a + run.offset, b + run.offset, run.length) == 0)
+                return;
+            if constexpr (last - first == 1)
+                return void(mask.set(first));
+        }
+
+        diff<T, first>(a, b, mask, members);
+    }
+
+    /**
+     * Copies the masked members of a contiguous run from one reflected instance into
+     * another. When all members of the run are masked, the whole run is copied at once.
+     * @tparam T The reflected type to be copied.
+     * @tparam J The index of the run to be copied.
+     * @param target The target instance's bytes.
+     * @param source The source instance's bytes.
+     * @param mask The mask of members to be copied.
+     */
+    template <typename T, size_t J>
+    REFLECTOR_INLINE void apply(uint8_t *target, const uint8_t *source, const member_mask_t<T>& mask) noexcept
+    {
+        using descriptor_t = typename reflection_t<T>::descriptor_t;
+        constexpr auto run = descriptor_t::runs[J];
+        constexpr size_t first = heads_v<T>[J], last = heads_v<T>[J + 1];
+
+        bool all = true;
+
+        for (size_t i = first; i < last && all; ++i)
+            all = mask.test(i);
+
+        if (all) {
+            std::memcpy(target + run.offset, source + run.offset, run.length);
+        } else {
+            for (size_t i = first; i < last; ++i) {
+                size_t offset = descriptor_t::offsets[i];
+                if (mask.test(i)) std::memcpy(target + offset, source + offset, descriptor_t::sizes[i]);
+            }
+        }
+    }
+
+    /**
+     * Compares all contiguous runs of members of two reflected instances.
+     * @tparam T The reflected type to be compared.
+     * @tparam J The runs index sequence.
+     * @param a The first instance to be compared.
+     * @param b The second instance to be compared.
+     * @return The mask of members which differ between the instances.
+     */
+    template <typename T, size_t ...J>
+    REFLECTOR_INLINE auto diff(const T& a, const T& b, std::index_sequence<J...>) noexcept
+    -> member_mask_t<T>
+    {
+        member_mask_t<T> mask;
+        auto abytes = reinterpret_cast<const uint8_t*>(&a);
+        auto bbytes = reinterpret_cast<const uint8_t*>(&b);
+        (diff<T, J>(abytes, bbytes, mask), ...);
+        return mask;
+    }
+
+    /**
+     * Copies the masked members of all contiguous runs between reflected instances.
+     * @tparam T The reflected type to be copied.
+     * @tparam J The runs index sequence.
+     * @param target The instance to copy members into.
+     * @param source The instance to copy members from.
+     * @param mask The mask of members to be copied.
+     */
+    template <typename T, size_t ...J>
+    REFLECTOR_INLINE void apply(
+        T& target
+      , const T& source
+      , const member_mask_t<T>& mask
+      , std::index_sequence<J...>
+    ) noexcept {
+        auto tbytes = reinterpret_cast<uint8_t*>(&target);
+        auto sbytes = reinterpret_cast<const uint8_t*>(&source);
+        (apply<T, J>(tbytes, sbytes, mask), ...);
+    }
+}
+
+/**
+ * Finds which members differ between two instances of a reflected type. Members are
+ * compared by their bytes, so that this can be used to find which members must be
+ * replicated. Padding bytes, including those within nested members, are never
+ * compared. Adjacent members which are not separated by padding are first compared
+ * at once, so that unchanged portions of the type are quickly skipped.
+ * @tparam T The reflected type to be compared.
+ * @param a The first instance to be compared.
+ * @param b The second instance to be compared.
+ * @return The mask of members which differ between the instances.
+ */
+template <typename T>
+REFLECTOR_INLINE auto diff(const T& a, const T& b) noexcept -> member_mask_t<T>
+{
+    using descriptor_t = typename reflection_t<T>::descriptor_t;
+    return detail::diff(a, b, std::make_index_sequence<descriptor_t::runs.size()>());
+}
+
+/**
+ * Copies the masked members of a reflected instance into another instance. Adjacent
+ * members which are all masked and not separated by padding are copied at once.
+ * @tparam T The reflected type to be copied.
+ * @param target The instance to copy members into.
+ * @param source The instance to copy members from.
+ * @param mask The mask of members to be copied.
+ */
+template <typename T>
+REFLECTOR_INLINE void apply(T& target, const T& source, const member_mask_t<T>& mask) noexcept
+{
+    using descriptor_t = typename reflection_t<T>::descriptor_t;
+    detail::apply(target, source, mask, std::make_index_sequence<descriptor_t::runs.size()>());
+}
+
+REFLECTOR_END_NAMESPACE
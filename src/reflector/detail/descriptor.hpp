@@ -6,17 +6,46 @@
  */
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <utility>
-#include <supertuple.h>
+#include <type_traits>
+#include <string_view>
 
 #include <reflector/environment.h>
+#include <reflector/detail/tuple.hpp>
+#include <reflector/detail/layout.hpp>
+#include <reflector/detail/names.hpp>
 
 REFLECTOR_BEGIN_NAMESPACE
 
-namespace supertuple = ::SUPERTUPLE_NAMESPACE;
-
 namespace detail
 {
+    /**
+     * Extracts the member type of a member pointer type.
+     * @tparam M The member pointer type.
+     * @since 1.0
+     */
+    template <typename M>
+    struct member_type_t;
+
+    template <typename T, typename R>
+    struct member_type_t<R T::*> { typedef R type; };
+
+    /**
+     * Finds the common type of a list of member types, if all members have the same type.
+     * @tparam R The member types to be inspected.
+     * @since 1.0
+     */
+    template <typename ...R>
+    struct homogeneous_t { typedef void type; };
+
+    template <typename E, typename ...R>
+    struct homogeneous_t<E, R...>
+    {
+        typedef std::conditional_t<(std::is_same_v<E, R> && ...), E, void> type;
+    };
+
     /**
      * The descriptor of a type, which aggregates a reflectible type with a tuple
      * of its corresponding internal properties' types.
@@ -38,22 +67,57 @@ namespace detail
         public:
             typedef T target_t;
 
-        private:
+        public:
+            using reflection_tuple_t = supertuple::tuple_t<R...>;
+            using reference_tuple_t = supertuple::tuple_t<R&...>;
+
+        public:
+            static constexpr size_t count = sizeof...(R);
+
             /**
-             * A generic aligned memory storage container.
-             * @tparam S The number of bytes in storage.
-             * @tparam A The byte alignment the storage should use.
+             * The sizes, alignments and offsets of each member of the described type.
+             * These tables are computed only once per described type, and can be
+             * freely used within constant expressions.
              * @since 1.0
              */
-            template <size_t S, size_t A>
-            struct alignas(A) storage_t {
-                alignas(A) uint8_t storage[S];
-            };
+            static constexpr std::array<size_t, count> sizes = {sizeof(R)...};
+            static constexpr std::array<size_t, count> alignments = {alignof(R)...};
+            static constexpr std::array<size_t, count> offsets = detail::layout(sizes, alignments);
 
-        public:
-            using reflection_tuple_t = supertuple::tuple_t<R...>;
-            using reference_tuple_t = supertuple::tuple_t<R&...>;
-            using storage_tuple_t = supertuple::tuple_t<storage_t<sizeof(R), alignof(R)>...>;
+            /**
+             * The offset of a single member of the described type. As a scalar constant,
+             * and unlike the offsets table, it can also be used within device code.
+             * @tparam N The index of the requested member.
+             * @since 1.0
+             */
+            template <size_t N>
+            static constexpr ptrdiff_t offset_v = static_cast<ptrdiff_t>(offsets[N]);
+
+            /**
+             * The contiguous runs of adjacent members of the described type. Members
+             * within a run are not separated by padding bytes and can thus be copied
+             * or compared as a single block of memory.
+             * @since 1.0
+             */
+            static constexpr std::array<run_t, detail::count_runs(sizes, offsets)> runs
+                = detail::coalesce<detail::count_runs(sizes, offsets)>(sizes, offsets);
+
+            /**
+             * The total number of bytes occupied by the described type's members, and
+             * whether the described type has any padding bytes amongst its members.
+             * @since 1.0
+             */
+            static constexpr size_t packed_size = (size_t(0) + ... + sizeof(R));
+            static constexpr bool has_padding = packed_size != sizeof(target_t);
+
+            /**
+             * Whether all members of the described type have the same type and are laid
+             * out without padding, so that they can be accessed as a contiguous array of
+             * their common type. For such types, the common member type is also given.
+             * @since 1.0
+             */
+            using homogeneous_t = typename detail::homogeneous_t<R...>::type;
+            static constexpr bool is_homogeneous = !std::is_void_v<homogeneous_t> && !has_padding;
 
         static_assert(
             sizeof (target_t) == sizeof (reflection_tuple_t) &&
@@ -61,6 +125,195 @@ namespace detail
           , "reflection tuple is not compatible with target type"
         );
     };
+
+    /**
+     * Maps each flattened member of a type to the index of its declared member.
+     * @tparam N The number of flattened members in the type.
+     * @tparam M The number of declared members in the type.
+     * @param extents The number of flattened members of each declared member.
+     * @return The declared member index of each flattened member.
+     */
+    template <size_t N, size_t M>
+    REFLECTOR_CONSTEXPR auto unflatten(const std::array<size_t, M>& extents) noexcept
+    -> std::array<size_t, N>
+    {
+        std::array<size_t, N> result {};
+
+        for (size_t i = 0, k = 0; i < M; ++i)
+            for (size_t j = 0; j < extents[i]; ++j)
+                result[k++] = i;
+
+        return result;
+    }
+
+    /**
+     * Finds the first flattened member of each one of a type's declared members.
+     * @tparam M The number of declared members in the type.
+     * @param extents The number of flattened members of each declared member.
+     * @return The first flattened member's index of each declared member.
+     */
+    template <size_t M>
+    REFLECTOR_CONSTEXPR auto firsts(const std::array<size_t, M>& extents) noexcept
+    -> std::array<size_t, M>
+    {
+        std::array<size_t, M> result {};
+
+        for (size_t i = 1; i < M; ++i)
+            result[i] = result[i - 1] + extents[i - 1];
+
+        return result;
+    }
+
+    /**
+     * Tags a type with its index within a list of types.
+     * @tparam I The index of the tagged type.
+     * @tparam T The tagged type.
+     * @since 1.0
+     */
+    template <size_t I, typename T>
+    struct indexed_t { using type = T; };
+
+    /**
+     * Indexes a list of types at once, so that each of them can be selected by its
+     * index through overload resolution, without recursively walking the list.
+     * @tparam I The index sequence of the list of types.
+     * @tparam T The list of types to be indexed.
+     * @since 1.0
+     */
+    template <typename I, typename ...T>
+    struct indexer_t;
+
+    template <size_t ...I, typename ...T>
+    struct indexer_t<std::index_sequence<I...>, T...> : indexed_t<I, T>... {};
+
+    /**
+     * Selects a type from an indexer by its index.
+     * @tparam I The index of the type to be selected.
+     * @tparam T The selected type.
+     * @return The selected type's tag.
+     */
+    template <size_t I, typename T>
+    REFLECTOR_CONSTEXPR auto select(const indexed_t<I, T>&) noexcept -> indexed_t<I, T>;
+
+    /**
+     * The descriptor of a type, which also records the names of its members.
+     * @tparam T The type to be reflected.
+     * @since 1.0
+     */
+    template <typename T, typename, typename, typename>
+    class named_descriptor_t;
+
+    /**
+     * The description entry of a specific reflectible type with named members. The
+     * names are kept within a single static block of characters, from which they are
+     * located by a table of offsets. Names can be looked up through a perfect hash.
+     * @tparam T The type to be reflected.
+     * @tparam R The internal property types tuple of the reflected type.
+     * @tparam N The type holding the block of characters with the member names.
+     * @tparam E The number of flattened members of each declared member.
+     * @since 1.0
+     */
+    template <typename T, typename R, typename N, size_t ...E>
+    class named_descriptor_t<T, R, N, std::index_sequence<E...>> : public descriptor_t<T, R>
+    {
+        private:
+            typedef descriptor_t<T, R> underlying_t;
+
+        public:
+            static constexpr size_t members = sizeof...(E);
+            static constexpr std::string_view block = N::value;
+
+        static_assert(
+            detail::count_names(block) == members
+          , "the number of member names does not match the number of members");
+
+        public:
+            /**
+             * The position of each declared member name within the names block, the
+             * declared member of each flattened member, and the first flattened member
+             * of each declared member.
+             * @since 1.0
+             */
+            static constexpr std::array<span_name_t, members> names = detail::split_names<members>(block);
+            static constexpr std::array<size_t, underlying_t::count> member_of
+                = detail::unflatten<underlying_t::count>(std::array<size_t, members> {E...});
+            static constexpr std::array<size_t, members> first_of
+                = detail::firsts(std::array<size_t, members> {E...});
+
+            /**
+             * The perfect hash table mapping each member name to its declared member.
+             * @since 1.0
+             */
+            static constexpr perfect_hash_t<members> hash = detail::build_hash(block, names);
+
+        static_assert(hash.valid, "duplicate or unhashable member names");
+    };
+
+    /**
+     * Accesses an element of a possibly multi-dimensional array member by its flattened
+     * index. Members which are not arrays are accessed as themselves.
+     * @tparam R The member type.
+     * @param member The member to be accessed.
+     * @param index The flattened index of the requested element.
+     * @return The requested element.
+     */
+    template <typename R>
+    REFLECTOR_CONSTEXPR auto element(R& member, size_t index) noexcept -> std::remove_all_extents_t<R>&
+    {
+        if constexpr (std::is_array_v<R>) {
+            constexpr size_t stride = sizeof(std::remove_extent_t<R>) / sizeof(std::remove_all_extents_t<R>);
+            return element(member[index / stride], index % stride);
+        } else {
+            return member;
+        }
+    }
+
+    /**
+     * The descriptor of a type, which also keeps the pointers to each of its members.
+     * As members are then accessed through member pointers rather than by their offsets,
+     * member accesses are also valid within constant expressions.
+     * @tparam D The underlying descriptor of the reflected type.
+     * @tparam P The pointers to each member of the reflected type.
+     * @since 1.0
+     */
+    template <typename D, auto ...P>
+    class member_descriptor_t : public D
+    {
+        private:
+            typedef D underlying_t;
+
+            template <typename M>
+            using member_t = typename detail::member_type_t<M>::type;
+
+            static constexpr std::array<size_t, sizeof...(P)> extents
+                = {(sizeof(member_t<decltype(P)>) / sizeof(std::remove_all_extents_t<member_t<decltype(P)>>))...};
+            static constexpr std::array<size_t, underlying_t::count> owner_of
+                = detail::unflatten<underlying_t::count>(extents);
+            static constexpr std::array<size_t, sizeof...(P)> start_of = detail::firsts(extents);
+
+            using pointers_t = indexer_t<
+                std::make_index_sequence<sizeof...(P)>
+              , std::integral_constant<decltype(P), P>...>;
+
+        public:
+            static constexpr bool has_member_pointers = true;
+
+            /**
+             * Accesses a member of an instance through its member pointer.
+             * @tparam N The flattened index of the requested member.
+             * @tparam Q The described type, possibly const-qualified.
+             * @param target The instance to access the member of.
+             * @return The requested member reference.
+             */
+            template <size_t N, typename Q>
+            REFLECTOR_CONSTEXPR static auto access(Q& target) noexcept -> auto&
+            {
+                constexpr size_t owner = owner_of[N];
+                constexpr size_t index = N - start_of[owner];
+                constexpr auto pointer = decltype(detail::select<owner>(std::declval<pointers_t>()))::type::value;
+                return detail::element(target.*pointer, index);
+            }
+    };
 }
 
 REFLECTOR_END_NAMESPACE
@@ -0,0 +1,106 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Compile-time computations over reflected types' memory layout.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <reflector/environment.h>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Computes the offsets of each member of a type with the given members' sizes
+     * and alignments, following the standard memory layout rules for aggregates.
+     * @tparam N The number of members in the described type.
+     * @param sizes The sizes of each member of the described type.
+     * @param alignments The alignment requirements of each member.
+     * @return The offset of each member within the described type.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto layout(
+        const std::array<size_t, N>& sizes
+      , const std::array<size_t, N>& alignments
+    ) noexcept -> std::array<size_t, N>
+    {
+        std::array<size_t, N> offsets {};
+
+        for (size_t i = 0, current = 0; i < N; ++i) {
+            current = (current + alignments[i] - 1) / alignments[i] * alignments[i];
+            offsets[i] = current;
+            current += sizes[i];
+        }
+
+        return offsets;
+    }
+
+    /**
+     * A contiguous run of adjacent members, with no padding bytes between them.
+     * @since 1.0
+     */
+    struct run_t
+    {
+        size_t offset;
+        size_t position;
+        size_t length;
+    };
+
+    /**
+     * Counts the number of contiguous runs of adjacent members in a type layout.
+     * @tparam N The number of members in the described type.
+     * @param sizes The sizes of each member of the described type.
+     * @param offsets The offsets of each member of the described type.
+     * @return The number of contiguous runs of members.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto count_runs(
+        const std::array<size_t, N>& sizes
+      , const std::array<size_t, N>& offsets
+    ) noexcept -> size_t
+    {
+        size_t count = 0;
+
+        for (size_t i = 0; i < N; ++i)
+            count += (i == 0 || offsets[i] != offsets[i - 1] + sizes[i - 1]);
+
+        return count;
+    }
+
+    /**
+     * Coalesces the adjacent members of a type layout into contiguous runs. Each run
+     * informs its offset within the described type, its position within a packed
+     * representation of the type, in which all padding bytes are removed, and its
+     * length in bytes.
+     * @tparam M The number of contiguous runs in the described type.
+     * @tparam N The number of members in the described type.
+     * @param sizes The sizes of each member of the described type.
+     * @param offsets The offsets of each member of the described type.
+     * @return The contiguous runs of members.
+     */
+    template <size_t M, size_t N>
+    REFLECTOR_CONSTEXPR auto coalesce(
+        const std::array<size_t, N>& sizes
+      , const std::array<size_t, N>& offsets
+    ) noexcept -> std::array<run_t, M>
+    {
+        std::array<run_t, M> result {};
+
+        for (size_t i = 0, j = 0, position = 0; i < N; position += sizes[i++]) {
+            if (i > 0 && offsets[i] == offsets[i - 1] + sizes[i - 1]) {
+                result[j - 1].length += sizes[i];
+            } else {
+                result[j++] = run_t {offsets[i], position, sizes[i]};
+            }
+        }
+
+        return result;
+    }
+}
+
+REFLECTOR_END_NAMESPACE
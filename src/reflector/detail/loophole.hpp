@@ -25,8 +25,8 @@
 #include <cstdint>
 #include <utility>
 
-#include <supertuple.h>
 #include <reflector/environment.h>
+#include <reflector/detail/tuple.hpp>
 
 #ifndef REFLECTOR_AVOID_LOOPHOLE
   #if REFLECTOR_CPP_DIALECT < 2014
@@ -46,8 +46,6 @@ REFLECTOR_DISABLE_GCC_WARNING_BEGIN("-Wnon-template-friend")
 
 REFLECTOR_BEGIN_NAMESPACE
 
-namespace supertuple = ::SUPERTUPLE_NAMESPACE;
-
 namespace detail
 {
     /**
@@ -124,29 +122,68 @@ namespace detail
     };
 
     /**
-     * The recursion base for counting the number of property members in the target
-     * type of a reflection processing.
+     * Checks whether the target type can be aggregate-initialized with the given
+     * number of decoys, which means that the target type has at least that number
+     * of property members.
      * @tparam T The target type for reflection processing.
-     * @return The total number of members within the target type.
+     * @return Can the target type be initialized with the decoys?
+     */
+    template <typename T, size_t ...I, size_t = sizeof(T{decoy_t<T, I>()...})>
+    REFLECTOR_CONSTEXPR auto initializable(std::index_sequence<I...>, int) noexcept -> bool
+    {
+        return true;
+    }
+
+    /**
+     * The fallback for when the target type cannot be aggregate-initialized with
+     * the given number of decoys.
+     * @tparam T The target type for reflection processing.
+     * @return Can the target type be initialized with the decoys?
      */
     template <typename T, size_t ...I>
-    REFLECTOR_CONSTEXPR auto count(...) noexcept -> size_t
+    REFLECTOR_CONSTEXPR auto initializable(std::index_sequence<I...>, ...) noexcept -> bool
     {
-        return sizeof...(I) - 1;
+        return false;
     }
 
     /**
-     * Recursively counts the number of property members in the target type of a
-     * reflection processing, by trying to construct the type with an increasing
-     * number of parameters. If the current number of parameters succeeds, then it
-     * is tested with one more parameter, until SFINAE.
+     * Binary searches the number of property members in the target type of a reflection
+     * processing, within an interval in which the target type is known to be possible
+     * to initialize with the lower bound number of decoys, but not with the upper one.
      * @tparam T The target type for reflection processing.
+     * @tparam L The interval's lower bound.
+     * @tparam H The interval's upper bound.
      * @return The total number of members within the target type.
      */
-    template <typename T, size_t ...I, size_t = sizeof(T{decoy_t<T, I>()...})>
-    REFLECTOR_CONSTEXPR auto count(int) noexcept -> size_t
+    template <typename T, size_t L, size_t H>
+    REFLECTOR_CONSTEXPR auto search() noexcept -> size_t
+    {
+        if constexpr (H - L <= 1) {
+            return L;
+        } else {
+            constexpr size_t M = L + (H - L) / 2;
+            if constexpr (initializable<T>(std::make_index_sequence<M>(), 0))
+                return search<T, M, H>();
+            else return search<T, L, M>();
+        }
+    }
+
+    /**
+     * Counts the number of property members in the target type of a reflection
+     * processing. The number of parameters the type is constructed with doubles
+     * at each step until SFINAE, and then the exact number of members is binary
+     * searched. Thus, only a logarithmic number of construction attempts, each with
+     * at most twice the number of members, must be instantiated.
+     * @tparam T The target type for reflection processing.
+     * @tparam N The current number of parameters to attempt constructing with.
+     * @return The total number of members within the target type.
+     */
+    template <typename T, size_t N = 1>
+    REFLECTOR_CONSTEXPR auto count() noexcept -> size_t
     {
-        return count<T, I..., sizeof...(I)>(0);
+        if constexpr (initializable<T>(std::make_index_sequence<N>(), 0))
+            return count<T, N * 2>();
+        else return search<T, N / 2, N>();
     }
 
     /**
@@ -167,7 +204,7 @@ namespace detail
      */
     template <typename T>
     REFLECTOR_CONSTEXPR auto loophole() noexcept
-    -> decltype(loophole1<T>(std::make_index_sequence<count<T>(0)>()));
+    -> decltype(loophole1<T>(std::make_index_sequence<count<T>()>()));
 }
 
 REFLECTOR_END_NAMESPACE
@@ -0,0 +1,198 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Compile-time member names tables and perfect hashing.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <reflector/environment.h>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * The position of a name within a contiguous block of characters.
+     * @since 1.0
+     */
+    struct span_name_t
+    {
+        size_t offset;
+        size_t length;
+    };
+
+    /**
+     * Counts the number of entries in a comma-separated list of member pointers, as
+     * produced by the stringification of a macro's variadic arguments.
+     * @param list The comma-separated list of member pointers.
+     * @return The number of entries in the list.
+     */
+    REFLECTOR_CONSTEXPR auto count_names(std::string_view list) noexcept -> size_t
+    {
+        size_t count = list.empty() ? 0 : 1;
+
+        for (size_t i = 0, depth = 0; i < list.size(); ++i) {
+            if (list[i] == '(' || list[i] == '<') ++depth;
+            else if (list[i] == ')' || list[i] == '>') --depth;
+            else if (list[i] == ',' && depth == 0) ++count;
+        }
+
+        return count;
+    }
+
+    /**
+     * Splits a comma-separated list of member pointers into the names of the pointed
+     * members. Each entry's name is the identifier following its last scope operator,
+     * so that both qualified member pointers and bare member names are accepted.
+     * @tparam N The number of entries in the list.
+     * @param list The comma-separated list of member pointers.
+     * @return The position of each member name within the list.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto split_names(std::string_view list) noexcept -> std::array<span_name_t, N>
+    {
+        std::array<span_name_t, N> result {};
+
+        for (size_t i = 0, j = 0, start = 0, depth = 0; i <= list.size(); ++i) {
+            if (i < list.size() && (list[i] == '(' || list[i] == '<')) ++depth;
+            else if (i < list.size() && (list[i] == ')' || list[i] == '>')) --depth;
+            else if (i == list.size() || (list[i] == ',' && depth == 0)) {
+                size_t end = i;
+                while (end > start && (list[end - 1] == ' ' || list[end - 1] == '\t' || list[end - 1] == '\n'))
+                    --end;
+                size_t begin = end;
+                while (begin > start && list[begin - 1] != ':' && list[begin - 1] != ' ' && list[begin - 1] != '&')
+                    --begin;
+                result[j++] = span_name_t {begin, end - begin};
+                start = i + 1;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * Hashes a name with the given seed, with the FNV-1a hashing function.
+     * @param name The name to be hashed.
+     * @param seed The seed to hash the name with.
+     * @return The name's hash.
+     */
+    REFLECTOR_CONSTEXPR auto hash_name(std::string_view name, uint32_t seed) noexcept -> uint32_t
+    {
+        uint32_t hash = 2166136261u ^ (seed * 16777619u);
+
+        for (char c : name)
+            hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+
+        return hash ^ (hash >> 15);
+    }
+
+    /**
+     * A perfect hash table for a fixed set of names. Names are first hashed into
+     * buckets, and then each bucket is assigned a seed which displaces its names into
+     * unique slots of a table, whose size is the smallest power of two not below twice
+     * the number of names. Looking a name up requires only two hashes and a single
+     * comparison, independently of the number of names in the table.
+     * @tparam N The number of names in the table.
+     * @since 1.0
+     */
+    template <size_t N>
+    struct perfect_hash_t
+    {
+        static constexpr size_t buckets = N > 0 ? N : 1;
+        static constexpr uint32_t attempts = 1u << 12;
+        static constexpr size_t slots = [] {
+            size_t size = 1;
+            while (size < 2 * N) size <<= 1;
+            return size;
+        }();
+
+        std::array<uint32_t, buckets> seeds {};
+        std::array<size_t, slots> table {};
+        bool valid = false;
+
+        /**
+         * Looks up the slot a name is mapped into.
+         * @param name The name to be looked up.
+         * @return The slot the name is mapped into.
+         */
+        REFLECTOR_CONSTEXPR auto slot(std::string_view name) const noexcept -> size_t
+        {
+            size_t bucket = hash_name(name, 0) % buckets;
+            return hash_name(name, seeds[bucket]) & (slots - 1);
+        }
+    };
+
+    /**
+     * Builds a perfect hash table for the given distinct names. Buckets are
+     * processed from the largest to the smallest, each searching for the first seed
+     * which places all of its names into free slots of the table. The table slots
+     * store the index of the name mapped into it, plus one, as zero marks a free slot.
+     * As duplicate names can never be placed into distinct slots, the search for each
+     * bucket's seed is limited, and the table is left invalid if any search fails.
+     * @tparam N The number of names to be hashed.
+     * @param block The contiguous block of characters containing the names.
+     * @param names The position of each name within the block.
+     * @return The perfect hash table for the names.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto build_hash(
+        std::string_view block
+      , const std::array<span_name_t, N>& names
+    ) noexcept -> perfect_hash_t<N>
+    {
+        using hash_t = perfect_hash_t<N>;
+
+        hash_t result {};
+        std::array<size_t, N> bucket {};
+        std::array<size_t, hash_t::buckets> sizes {}, order {};
+
+        for (size_t i = 0; i < N; ++i) {
+            bucket[i] = hash_name(block.substr(names[i].offset, names[i].length), 0) % hash_t::buckets;
+            ++sizes[bucket[i]];
+        }
+
+        for (size_t i = 0; i < hash_t::buckets; ++i) {
+            size_t j = i;
+            for (; j > 0 && sizes[order[j - 1]] < sizes[i]; --j)
+                order[j] = order[j - 1];
+            order[j] = i;
+        }
+
+        for (size_t b : order) {
+            if (sizes[b] == 0) break;
+
+            for (uint32_t seed = 1;; ++seed) {
+                if (seed > hash_t::attempts)
+                    return result;
+
+                bool success = true;
+                std::array<size_t, hash_t::slots> table = result.table;
+
+                for (size_t i = 0; i < N && success; ++i) {
+                    if (bucket[i] != b) continue;
+                    size_t slot = hash_name(block.substr(names[i].offset, names[i].length), seed) & (hash_t::slots - 1);
+                    success = table[slot] == 0;
+                    table[slot] = i + 1;
+                }
+
+                if (success) {
+                    result.seeds[b] = seed;
+                    result.table = table;
+                    break;
+                }
+            }
+        }
+
+        result.valid = true;
+        return result;
+    }
+}
+
+REFLECTOR_END_NAMESPACE
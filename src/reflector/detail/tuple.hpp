@@ -0,0 +1,393 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The tuple types on which reflections are built.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+
+#if !REFLECTOR_LEAN_TUPLE_ENABLED
+#include <supertuple.h>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace supertuple = ::SUPERTUPLE_NAMESPACE;
+
+REFLECTOR_END_NAMESPACE
+
+#else
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/*
+ * A minimal replacement for the supertuple library, providing only the tuple features
+ * reflections are built upon. The tuples' memory layout is identical to supertuple's,
+ * so that reflected types and their reflection tuples remain layout-compatible.
+ */
+namespace supertuple
+{
+    namespace detail
+    {
+        /**
+         * Holds a single element of a tuple. Each element is kept in a distinct base
+         * class of the tuple, so that elements are laid out in declaration order.
+         * @tparam I The index of the element within the tuple.
+         * @tparam T The type of the element.
+         * @since 1.0
+         */
+        template <size_t I, typename T>
+        struct leaf_t
+        {
+            T value;
+
+            REFLECTOR_CONSTEXPR leaf_t() = default;
+            REFLECTOR_CONSTEXPR leaf_t(const leaf_t&) = default;
+            REFLECTOR_CONSTEXPR leaf_t(leaf_t&&) = default;
+
+            /**
+             * Initializes the element from a value.
+             * @tparam U The type of the value to initialize the element with.
+             * @param value The value to initialize the element with.
+             */
+            template <typename U, typename = std::enable_if_t<std::is_convertible_v<U, T>>>
+            REFLECTOR_CONSTEXPR leaf_t(U&& value)
+              : value (std::forward<U>(value))
+            {}
+
+            REFLECTOR_CONSTEXPR leaf_t& operator=(const leaf_t&) = default;
+            REFLECTOR_CONSTEXPR leaf_t& operator=(leaf_t&&) = default;
+        };
+
+        /**
+         * Holds a reference element of a tuple. Assigning to a reference element writes
+         * to the referenced value, rather than rebinding the reference.
+         * @tparam I The index of the element within the tuple.
+         * @tparam T The type of the referenced value.
+         * @since 1.0
+         */
+        template <size_t I, typename T>
+        struct leaf_t<I, T&>
+        {
+            T& value;
+
+            REFLECTOR_CONSTEXPR leaf_t(T& value) noexcept
+              : value (value)
+            {}
+
+            REFLECTOR_CONSTEXPR leaf_t(const leaf_t&) noexcept = default;
+
+            REFLECTOR_CONSTEXPR leaf_t& operator=(const leaf_t& other)
+            {
+                value = other.value;
+                return *this;
+            }
+        };
+
+        /**
+         * Retrieves the type of an element of a type list by its index.
+         * @tparam I The index of the requested type.
+         * @tparam T The list of types.
+         * @since 1.0
+         */
+        template <size_t I, typename T, typename ...R>
+        struct type_at_t : type_at_t<I - 1, R...> {};
+
+        template <typename T, typename ...R>
+        struct type_at_t<0, T, R...> { using type = T; };
+
+        /**
+         * The base of a tuple, inheriting from each one of the tuple's element leaves.
+         * @tparam I The tuple's elements index sequence.
+         * @tparam T The tuple's element types.
+         * @since 1.0
+         */
+        template <typename I, typename ...T>
+        struct base_t;
+
+        template <size_t ...I, typename ...T>
+        struct base_t<std::index_sequence<I...>, T...> : public leaf_t<I, T>...
+        {
+            REFLECTOR_CONSTEXPR base_t() = default;
+            REFLECTOR_CONSTEXPR base_t(const base_t&) = default;
+            REFLECTOR_CONSTEXPR base_t(base_t&&) = default;
+
+            /**
+             * Initializes each one of the tuple's elements from a value.
+             * @tparam U The types of the values to initialize the elements with.
+             * @param value The values to initialize the elements with.
+             */
+            template <
+                typename ...U
+              , typename = std::enable_if_t<sizeof...(U) == sizeof...(T) && (sizeof...(T) > 0)>>
+            REFLECTOR_CONSTEXPR base_t(U&&... value)
+              : leaf_t<I, T>(std::forward<U>(value))...
+            {}
+
+            REFLECTOR_CONSTEXPR base_t& operator=(const base_t&) = default;
+            REFLECTOR_CONSTEXPR base_t& operator=(base_t&&) = default;
+        };
+    }
+
+    /**
+     * A tuple of heterogeneous elements, laid out in memory in declaration order.
+     * @tparam T The tuple's element types.
+     * @since 1.0
+     */
+    template <typename ...T>
+    class tuple_t : public detail::base_t<std::index_sequence_for<T...>, T...>
+    {
+        private:
+            typedef detail::base_t<std::index_sequence_for<T...>, T...> underlying_t;
+
+        public:
+            static constexpr size_t count = sizeof...(T);
+
+            /**
+             * Retrieves the type of one of the tuple's elements.
+             * @tparam I The index of the requested element.
+             * @since 1.0
+             */
+            template <size_t I>
+            using element_t = typename detail::type_at_t<I, T...>::type;
+
+        public:
+            using underlying_t::underlying_t;
+
+            REFLECTOR_CONSTEXPR tuple_t() = default;
+            REFLECTOR_CONSTEXPR tuple_t(const tuple_t&) = default;
+            REFLECTOR_CONSTEXPR tuple_t(tuple_t&&) = default;
+
+            REFLECTOR_CONSTEXPR tuple_t& operator=(const tuple_t&) = default;
+            REFLECTOR_CONSTEXPR tuple_t& operator=(tuple_t&&) = default;
+
+            /**
+             * Retrieves one of the tuple's elements by its index.
+             * @tparam I The index of the requested element.
+             * @return The requested element reference.
+             */
+            template <size_t I>
+            REFLECTOR_CONSTEXPR decltype(auto) get() noexcept
+            {
+                return (static_cast<detail::leaf_t<I, element_t<I>>&>(*this).value);
+            }
+
+            /**
+             * Retrieves one of the tuple's elements by its index.
+             * @tparam I The index of the requested element.
+             * @return The requested constant element reference.
+             */
+            template <size_t I>
+            REFLECTOR_CONSTEXPR decltype(auto) get() const noexcept
+            {
+                return (static_cast<const detail::leaf_t<I, element_t<I>>&>(*this).value);
+            }
+    };
+
+    /**
+     * The empty tuple, which has no elements.
+     * @since 1.0
+     */
+    template <>
+    class tuple_t<>
+    {
+        public:
+            static constexpr size_t count = 0;
+    };
+
+    namespace detail
+    {
+        /**
+         * Produces a tuple with a number of elements of the same type.
+         * @tparam T The type of the tuple's elements.
+         * @tparam I The tuple's elements index sequence.
+         * @since 1.0
+         */
+        template <typename T, typename I>
+        struct repeat_t;
+
+        template <typename T, size_t ...I>
+        struct repeat_t<T, std::index_sequence<I...>>
+        {
+            using type = tuple_t<std::enable_if_t<(I >= 0), T>...>;
+        };
+    }
+
+    /**
+     * A tuple with a number of elements of the same type.
+     * @tparam T The type of the tuple's elements.
+     * @tparam N The number of elements in the tuple.
+     * @since 1.0
+     */
+    template <typename T, size_t N>
+    class ntuple_t : public detail::repeat_t<T, std::make_index_sequence<N>>::type
+    {
+        public:
+            typedef typename detail::repeat_t<T, std::make_index_sequence<N>>::type base_tuple_t;
+
+        public:
+            using base_tuple_t::base_tuple_t;
+    };
+
+    /**
+     * Retrieves one of a tuple's elements by its index.
+     * @tparam I The index of the requested element.
+     * @tparam T The tuple's element types.
+     * @param tuple The tuple to retrieve the element from.
+     * @return The requested element reference.
+     */
+    template <size_t I, typename ...T>
+    REFLECTOR_CONSTEXPR decltype(auto) get(tuple_t<T...>& tuple) noexcept
+    {
+        return tuple.template get<I>();
+    }
+
+    /**
+     * Retrieves one of a constant tuple's elements by its index.
+     * @tparam I The index of the requested element.
+     * @tparam T The tuple's element types.
+     * @param tuple The tuple to retrieve the element from.
+     * @return The requested constant element reference.
+     */
+    template <size_t I, typename ...T>
+    REFLECTOR_CONSTEXPR decltype(auto) get(const tuple_t<T...>& tuple) noexcept
+    {
+        return tuple.template get<I>();
+    }
+
+    /**
+     * Modifies the value of one of a tuple's elements by its index.
+     * @tparam I The index of the element to be modified.
+     * @tparam T The tuple's element types.
+     * @tparam U The type of the new element value.
+     * @param tuple The tuple to have an element modified.
+     * @param value The value to assign to the element.
+     */
+    template <size_t I, typename ...T, typename U>
+    REFLECTOR_CONSTEXPR void set(tuple_t<T...>& tuple, U&& value)
+    {
+        tuple.template get<I>() = std::forward<U>(value);
+    }
+
+    namespace detail
+    {
+        /**
+         * Concatenates the elements of two tuples into a new tuple.
+         * @tparam A The first tuple's element types.
+         * @tparam B The second tuple's element types.
+         * @tparam I The first tuple's elements index sequence.
+         * @tparam J The second tuple's elements index sequence.
+         * @param a The first tuple to be concatenated.
+         * @param b The second tuple to be concatenated.
+         * @return The concatenated tuple.
+         */
+        template <typename ...A, typename ...B, size_t ...I, size_t ...J>
+        REFLECTOR_CONSTEXPR auto concat(
+            const tuple_t<A...>& a
+          , const tuple_t<B...>& b
+          , std::index_sequence<I...>
+          , std::index_sequence<J...>
+        ) -> tuple_t<A..., B...> {
+            if constexpr (sizeof...(A) + sizeof...(B) > 0)
+                return tuple_t<A..., B...>(a.template get<I>()..., b.template get<J>()...);
+            else return tuple_t<>();
+        }
+
+        /**
+         * Folds a list of values from left to right with a binary function.
+         * @tparam F The type of the folding function.
+         * @tparam A The type of the accumulated value.
+         * @param lambda The folding function.
+         * @param accumulator The value accumulated so far.
+         * @return The folded value.
+         */
+        template <typename F, typename A>
+        REFLECTOR_CONSTEXPR auto foldl(F&, A&& accumulator)
+        {
+            return accumulator;
+        }
+
+        template <typename F, typename A, typename B, typename ...R>
+        REFLECTOR_CONSTEXPR auto foldl(F& lambda, A&& accumulator, B&& value, R&&... rest)
+        {
+            return foldl(
+                lambda
+              , lambda(std::forward<A>(accumulator), std::forward<B>(value))
+              , std::forward<R>(rest)...);
+        }
+
+        /**
+         * Folds the elements of a tuple from left to right with a binary function.
+         * @tparam F The type of the folding function.
+         * @tparam T The tuple's element types.
+         * @tparam I The tuple's elements index sequence.
+         * @param tuple The tuple to be folded.
+         * @param lambda The folding function.
+         * @return The folded value.
+         */
+        template <typename F, typename ...T, size_t ...I>
+        REFLECTOR_CONSTEXPR auto fold_tuple(const tuple_t<T...>& tuple, F& lambda, std::index_sequence<I...>)
+        {
+            return foldl(lambda, tuple.template get<I>()...);
+        }
+    }
+
+    /**
+     * Concatenates the elements of two tuples into a new tuple.
+     * @tparam A The first tuple's element types.
+     * @tparam B The second tuple's element types.
+     * @param a The first tuple to be concatenated.
+     * @param b The second tuple to be concatenated.
+     * @return The concatenated tuple.
+     */
+    template <typename ...A, typename ...B>
+    REFLECTOR_CONSTEXPR auto concat(const tuple_t<A...>& a, const tuple_t<B...>& b) -> tuple_t<A..., B...>
+    {
+        return detail::concat(a, b, std::index_sequence_for<A...>(), std::index_sequence_for<B...>());
+    }
+
+    /**
+     * Folds the elements of a non-empty tuple from left to right with a binary function,
+     * using the tuple's first element as the initial accumulated value.
+     * @tparam T The tuple's element types.
+     * @tparam F The type of the folding function.
+     * @param tuple The tuple to be folded.
+     * @param lambda The folding function.
+     * @return The folded value.
+     */
+    template <typename ...T, typename F>
+    REFLECTOR_CONSTEXPR auto foldl(const tuple_t<T...>& tuple, F&& lambda)
+    {
+        static_assert(sizeof...(T) > 0, "cannot fold an empty tuple without an initial value");
+        return detail::fold_tuple(tuple, lambda, std::index_sequence_for<T...>());
+    }
+}
+
+REFLECTOR_END_NAMESPACE
+
+/**
+ * Informs the size of a tuple, allowing it to be deconstructed.
+ * @tparam T The tuple's element types.
+ * @since 1.0
+ */
+template <typename ...T>
+struct std::tuple_size<REFLECTOR_NAMESPACE::supertuple::tuple_t<T...>>
+  : std::integral_constant<size_t, sizeof...(T)> {};
+
+/**
+ * Retrieves the deconstruction type of a tuple's element.
+ * @tparam I The index of the requested tuple element.
+ * @tparam T The tuple's element types.
+ * @since 1.0
+ */
+template <size_t I, typename ...T>
+struct std::tuple_element<I, REFLECTOR_NAMESPACE::supertuple::tuple_t<T...>> {
+    using type = typename REFLECTOR_NAMESPACE::supertuple::tuple_t<T...>::template element_t<I>;
+};
+
+#endif
@@ -0,0 +1,219 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Byte order conversion of reflected types' members.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/flat.hpp>
+#include <reflector/span.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * Informs whether the target architecture stores multi-byte values in big-endian order.
+ * In such architectures, converting to or from big-endian order does nothing.
+ * @since 1.0
+ */
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  inline constexpr bool is_big_endian_v = true;
+#else
+  inline constexpr bool is_big_endian_v = false;
+#endif
+
+namespace detail
+{
+    /**
+     * The unsigned integer type with the given width in bytes.
+     * @tparam W The width of the requested type.
+     * @since 1.0
+     */
+    template <size_t W> struct word_t;
+    template <> struct word_t<2> { typedef uint16_t type; };
+    template <> struct word_t<4> { typedef uint32_t type; };
+    template <> struct word_t<8> { typedef uint64_t type; };
+
+    /**
+     * Reverses the bytes of an unsigned integer.
+     * @tparam U The unsigned integer type.
+     * @param value The value to have its bytes reversed.
+     * @return The byte-reversed value.
+     */
+    template <typename U>
+    REFLECTOR_CONSTEXPR U byteswap(U value) noexcept
+    {
+      #if REFLECTOR_HOST_COMPILER != REFLECTOR_HOST_COMPILER_UNKNOWN
+        if constexpr (sizeof(U) == 2) return __builtin_bswap16(value);
+        if constexpr (sizeof(U) == 4) return __builtin_bswap32(value);
+        if constexpr (sizeof(U) == 8) return __builtin_bswap64(value);
+      #else
+        U result = 0;
+        for (size_t i = 0; i < sizeof(U); ++i, value >>= 8)
+            result = static_cast<U>((result << 8) | (value & 0xff));
+        return result;
+      #endif
+    }
+
+    /**
+     * Checks whether a leaf member type must have its bytes swapped to change its order.
+     * @tparam E The leaf member type to be checked.
+     * @since 1.0
+     */
+    template <typename E>
+    inline constexpr bool swappable_v = (std::is_arithmetic_v<E> || std::is_enum_v<E>)
+        && (sizeof(E) == 2 || sizeof(E) == 4 || sizeof(E) == 8);
+
+    /**
+     * Reverses the bytes of a member in place. The member is accessed by its bytes,
+     * so that floating-point members can also be swapped.
+     * @tparam W The width of the member to be swapped.
+     * @param bytes The member's first byte.
+     */
+    template <size_t W>
+    REFLECTOR_INLINE void byteswap(uint8_t *bytes) noexcept
+    {
+        typename word_t<W>::type word;
+        std::memcpy(&word, bytes, W);
+        word = byteswap(word);
+        std::memcpy(bytes, &word, W);
+    }
+
+    /**
+     * Finds the common width of all leaf members of a type, if they all have the same
+     * width, are swappable and leave no padding. Such types can be swapped as if they
+     * were a plain array of words.
+     * @tparam T The reflected type to be inspected.
+     * @tparam L The leaf member types.
+     * @return The common width of all leaf members, or zero if there is none.
+     */
+    template <typename T, typename ...L>
+    REFLECTOR_CONSTEXPR size_t uniform_width(supertuple::tuple_t<L...>*) noexcept
+    {
+        constexpr size_t width = sizeof(std::tuple_element_t<0, supertuple::tuple_t<L...>>);
+        return !flat_reflection_t<T>::descriptor_t::has_padding
+            && ((swappable_v<L> && sizeof(L) == width) && ...) ? width : 0;
+    }
+
+    /**
+     * The common width of all leaf members of a reflected type, or zero if there is none.
+     * @tparam T The reflected type to be inspected.
+     * @since 1.0
+     */
+    template <typename T>
+    inline constexpr size_t uniform_width_v = uniform_width<T>(
+        static_cast<typename flat_reflection_t<T>::reflection_tuple_t*>(nullptr));
+
+    /**
+     * Swaps the bytes of a leaf member of every instance in a batch. The member is
+     * located with a fixed stride, so that the loop can be vectorized.
+     * @tparam N The index of the leaf member to be swapped.
+     * @tparam T The reflected type of the batch's instances.
+     * @param base The batch's first byte.
+     * @param count The number of instances in the batch.
+     */
+    template <size_t N, typename T>
+    REFLECTOR_INLINE void byteswap_column(uint8_t *base, size_t count) noexcept
+    {
+        using E = typename flat_reflection_t<T>::reflection_tuple_t::template element_t<N>;
+
+        if constexpr (swappable_v<E>) {
+            constexpr size_t shift = flat_reflection_t<T>::descriptor_t::offsets[N];
+            for (size_t i = 0; i < count; ++i)
+                byteswap<sizeof(E)>(base + shift + i * sizeof(T));
+        }
+    }
+
+    /**
+     * Swaps the bytes of all leaf members of every instance in a batch.
+     * @tparam T The reflected type of the batch's instances.
+     * @tparam I The leaf members index sequence.
+     * @param base The batch's first byte.
+     * @param count The number of instances in the batch.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE void byteswap_batch(uint8_t *base, size_t count, std::index_sequence<I...>) noexcept
+    {
+        if constexpr (uniform_width_v<T> != 0) {
+            constexpr size_t width = uniform_width_v<T>;
+            for (size_t i = 0, n = count * sizeof(T) / width; i < n; ++i)
+                byteswap<width>(base + i * width);
+        } else {
+            (byteswap_column<I, T>(base, count), ...);
+        }
+    }
+
+    /**
+     * Reverses the byte order of every arithmetic leaf member in a batch.
+     * @tparam T The reflected type of the batch's instances.
+     * @param batch The batch of instances to be converted.
+     */
+    template <typename T>
+    REFLECTOR_INLINE void byteswap_batch(span_t<T> batch) noexcept
+    {
+        static_assert(!std::is_const_v<T>, "byte order conversion requires mutable instances");
+        constexpr size_t count = flat_reflection_t<T>::count;
+        auto base = reinterpret_cast<uint8_t*>(batch.data());
+        byteswap_batch<T>(base, batch.size(), std::make_index_sequence<count>());
+    }
+}
+
+/**
+ * Converts the arithmetic leaf members of a batch of instances from the native byte
+ * order to big-endian. Leaves are converted column by column, or as a plain array of
+ * words when all leaves have the same width, so that swaps can be vectorized.
+ * @tparam T The reflected type of the batch's instances.
+ * @param batch The batch of instances to be converted in place.
+ */
+template <typename T>
+REFLECTOR_INLINE void to_big_endian(span_t<T> batch) noexcept
+{
+    if constexpr (!is_big_endian_v)
+        detail::byteswap_batch(batch);
+}
+
+/**
+ * Converts the arithmetic leaf members of a batch of instances from big-endian to
+ * the native byte order.
+ * @tparam T The reflected type of the batch's instances.
+ * @param batch The batch of instances to be converted in place.
+ */
+template <typename T>
+REFLECTOR_INLINE void from_big_endian(span_t<T> batch) noexcept
+{
+    if constexpr (!is_big_endian_v)
+        detail::byteswap_batch(batch);
+}
+
+/**
+ * Converts the arithmetic leaf members of an instance from the native byte order to
+ * big-endian. Members of a single byte are left untouched.
+ * @tparam T The reflected type to be converted.
+ * @param target The instance to be converted in place.
+ */
+template <typename T>
+REFLECTOR_INLINE void to_big_endian(T& target) noexcept
+{
+    to_big_endian(span_t<T>(&target, 1));
+}
+
+/**
+ * Converts the arithmetic leaf members of an instance from big-endian to the native
+ * byte order. Members of a single byte are left untouched.
+ * @tparam T The reflected type to be converted.
+ * @param target The instance to be converted in place.
+ */
+template <typename T>
+REFLECTOR_INLINE void from_big_endian(T& target) noexcept
+{
+    from_big_endian(span_t<T>(&target, 1));
+}
+
+REFLECTOR_END_NAMESPACE
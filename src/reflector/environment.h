@@ -35,6 +35,35 @@
   #define REFLECTOR_ENVIRONMENT "Production"
 #endif
 
+/*
+ * Discovers whether the instrumentation of reflected types has been requested. When
+ * enabled, each reflected type is registered once with its layout information, and
+ * accesses to its members are counted and may be sampled by a runtime hook. When
+ * disabled, the instrumentation points expand to nothing and the instrumentation
+ * header is never included, so that no instrumentation code is ever produced. As the
+ * instrumentation changes the definitions of inline functions, `REFLECTOR_TRACE` must
+ * be either defined or undefined in every translation unit of a program alike, as
+ * otherwise the One Definition Rule would be violated.
+ */
+#if defined(REFLECTOR_TRACE)
+  #define REFLECTOR_TRACE_ENABLED 1
+#else
+  #define REFLECTOR_TRACE_ENABLED 0
+  #define REFLECTOR_TRACE_INSTANCE(T, D)
+  #define REFLECTOR_TRACE_ACCESS(T, D, N)
+#endif
+
+/*
+ * Discovers whether reflections must be built upon the library's own minimal tuple
+ * implementation instead of the supertuple library. The minimal tuple only provides
+ * the features reflections need, thus reducing the cost of including the library.
+ */
+#if defined(REFLECTOR_LEAN_TUPLE)
+  #define REFLECTOR_LEAN_TUPLE_ENABLED 1
+#else
+  #define REFLECTOR_LEAN_TUPLE_ENABLED 0
+#endif
+
 /*
  * Enumerating known host compilers. These compilers are not all necessarily officially
  * supported. Nevertheless, some special adaptation or fixes might be implemented
@@ -218,6 +247,14 @@
   #define REFLECTOR_CUDA_ENABLED
 #endif
 
+/*
+ * The size, in bytes, of the target architecture's cache lines. This is used when
+ * analysing or producing memory layouts and might be overriden if needed.
+ */
+#if !defined(REFLECTOR_CACHE_LINE_SIZE)
+  #define REFLECTOR_CACHE_LINE_SIZE 64
+#endif
+
 /*
  * Macros for applying annotations and qualifiers to functions and methods. As the
  * minimum required language version is C++17, we assume it is guaranteed that all
@@ -0,0 +1,321 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The recursive flattening reflection of nested aggregate types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/detail/tuple.hpp>
+#include <reflector/reflector.hpp>
+#include <reflector/detail/layout.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Checks whether a member type is an aggregate to be recursively reflected over
+     * when flattening the members of its enclosing type.
+     * @tparam R The member type to be checked.
+     * @since 1.0
+     */
+    template <typename R>
+    inline constexpr bool nested_v = std::is_class_v<R>
+        && std::is_aggregate_v<R>
+        && std::is_trivial_v<R>
+        && !std::is_empty_v<R>;
+
+    /**
+     * Joins the leaf types of many tuples into a single tuple.
+     * @tparam L The tuples to be joined.
+     * @since 1.0
+     */
+    template <typename ...L>
+    struct join_t;
+
+    template <typename ...A>
+    struct join_t<supertuple::tuple_t<A...>>
+    {
+        using type = supertuple::tuple_t<A...>;
+        using reference_t = supertuple::tuple_t<A&...>;
+    };
+
+    template <typename ...A, typename ...B, typename ...L>
+    struct join_t<supertuple::tuple_t<A...>, supertuple::tuple_t<B...>, L...>
+      : join_t<supertuple::tuple_t<A..., B...>, L...> {};
+
+    /*
+     * Forward declaration of the flat descriptor, so that the leaves of a member
+     * can be obtained from the member's own flat descriptor.
+     * @since 1.0
+     */
+    template <typename T, typename = typename reflection_t<T>::reflection_tuple_t>
+    class flat_descriptor_t;
+
+    /**
+     * The leaves of a member which must not be recursively reflected over, that
+     * is, the member itself at the beginning of its storage.
+     * @tparam R The member type.
+     * @since 1.0
+     */
+    template <typename R, bool = nested_v<R>>
+    struct leaves_t
+    {
+        using type = supertuple::tuple_t<R>;
+        static constexpr std::array<size_t, 1> offsets = {0};
+    };
+
+    /**
+     * The leaves of a nested aggregate member, relative to the member's storage.
+     * @tparam R The member type.
+     * @since 1.0
+     */
+    template <typename R>
+    struct leaves_t<R, true>
+    {
+        using type = typename flat_descriptor_t<R>::reflection_tuple_t;
+        static constexpr auto offsets = flat_descriptor_t<R>::offsets;
+    };
+
+    /**
+     * The description of a type's leaf members. Nested aggregate members are
+     * recursively replaced by their own leaf members, whose offsets are absolute
+     * within the described type.
+     * @tparam T The type to be described.
+     * @tparam R The internal property types of the described type.
+     * @since 1.0
+     */
+    template <typename T, typename ...R>
+    class flat_descriptor_t<T, supertuple::tuple_t<R...>>
+    {
+        public:
+            typedef T target_t;
+
+        private:
+            typedef typename reflection_t<T>::descriptor_t underlying_t;
+            typedef detail::join_t<supertuple::tuple_t<>, typename leaves_t<R>::type...> joined_t;
+
+        public:
+            using reflection_tuple_t = typename joined_t::type;
+            using reference_tuple_t = typename joined_t::reference_t;
+
+        public:
+            static constexpr size_t count = reflection_tuple_t::count;
+
+        private:
+            /**
+             * Places the leaves of a member at the member's offset.
+             * @tparam M The number of leaves in the member.
+             * @param result The leaf offsets being placed.
+             * @param k The index of the member's first leaf.
+             * @param base The offset of the member.
+             * @param offsets The offsets of the member's leaves within the member.
+             */
+            template <size_t M>
+            REFLECTOR_CONSTEXPR static void place(
+                std::array<size_t, count>& result
+              , size_t& k
+              , size_t base
+              , const std::array<size_t, M>& offsets
+            ) noexcept {
+                for (size_t j = 0; j < M; ++j)
+                    result[k++] = base + offsets[j];
+            }
+
+            /**
+             * Computes the absolute offsets of all leaves within the described type.
+             * @tparam I The members index sequence.
+             * @return The leaf offsets.
+             */
+            template <size_t ...I>
+            REFLECTOR_CONSTEXPR static auto place(std::index_sequence<I...>) noexcept
+            -> std::array<size_t, count>
+            {
+                std::array<size_t, count> result {};
+                size_t k = 0;
+                (place(result, k, underlying_t::offsets[I], leaves_t<R>::offsets), ...);
+                return result;
+            }
+
+            /**
+             * Gathers the sizes of all leaves within the described type.
+             * @tparam L The leaf types.
+             * @return The leaf sizes.
+             */
+            template <typename ...L>
+            REFLECTOR_CONSTEXPR static auto measure(supertuple::tuple_t<L...>*) noexcept
+            -> std::array<size_t, count>
+            {
+                return {sizeof(L)...};
+            }
+
+            /**
+             * Sums the sizes of all leaves within the described type.
+             * @param sizes The leaf sizes.
+             * @return The total size of all leaves.
+             */
+            REFLECTOR_CONSTEXPR static size_t total(const std::array<size_t, count>& sizes) noexcept
+            {
+                size_t result = 0;
+                for (size_t size : sizes) result += size;
+                return result;
+            }
+
+        public:
+            /**
+             * The sizes and absolute offsets of each leaf of the described type.
+             * @since 1.0
+             */
+            static constexpr std::array<size_t, count> sizes
+                = measure(static_cast<reflection_tuple_t*>(nullptr));
+            static constexpr std::array<size_t, count> offsets
+                = place(std::make_index_sequence<sizeof...(R)>());
+
+            /**
+             * The offset of a single leaf of the described type.
+             * @tparam N The index of the requested leaf.
+             * @since 1.0
+             */
+            template <size_t N>
+            static constexpr ptrdiff_t offset_v = static_cast<ptrdiff_t>(offsets[N]);
+
+            /**
+             * The contiguous runs of adjacent leaves of the described type. Unlike the
+             * runs of a non-flattened descriptor, these are also split by the padding
+             * bytes within nested members.
+             * @since 1.0
+             */
+            static constexpr std::array<run_t, detail::count_runs(sizes, offsets)> runs
+                = detail::coalesce<detail::count_runs(sizes, offsets)>(sizes, offsets);
+
+            /**
+             * The total number of bytes occupied by the described type's leaves, and
+             * whether there are any padding bytes amongst them.
+             * @since 1.0
+             */
+            static constexpr size_t packed_size = total(sizes);
+            static constexpr bool has_padding = packed_size != sizeof(target_t);
+    };
+}
+
+/**
+ * Reflects over a type's leaf members, recursively expanding its nested aggregate
+ * members. Thus, a deeply nested type can be walked through with a single flat loop
+ * over its leaves, rather than through nested temporary reflections.
+ * @tparam T The target data type to be introspected.
+ * @since 1.0
+ */
+template <typename T>
+class flat_reflection_t : public detail::flat_descriptor_t<T>::reference_tuple_t
+{
+    public:
+        typedef T target_t;
+
+    public:
+        using descriptor_t = detail::flat_descriptor_t<T>;
+        using reference_tuple_t = typename descriptor_t::reference_tuple_t;
+        using reflection_tuple_t = typename descriptor_t::reflection_tuple_t;
+
+    private:
+        typedef reference_tuple_t underlying_t;
+
+    public:
+        REFLECTOR_INLINE flat_reflection_t() noexcept = delete;
+        REFLECTOR_INLINE flat_reflection_t(const flat_reflection_t&) noexcept = default;
+        REFLECTOR_INLINE flat_reflection_t(flat_reflection_t&&) noexcept = default;
+
+        /**
+         * Reflects over an instance and gathers references to its leaf members.
+         * @param target The target instance to get references from.
+         */
+        REFLECTOR_INLINE flat_reflection_t(T& target) noexcept
+          : underlying_t (extract(target, std::make_index_sequence<underlying_t::count>()))
+        {}
+
+        REFLECTOR_INLINE flat_reflection_t& operator=(const flat_reflection_t&) = default;
+        REFLECTOR_INLINE flat_reflection_t& operator=(flat_reflection_t&&) = default;
+
+    public:
+        /**
+         * Retrieves the absolute offset of a leaf member of the reflected type.
+         * @tparam N The index of required leaf member.
+         * @return The leaf member offset.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto offset() noexcept -> ptrdiff_t
+        {
+            static_assert(N < descriptor_t::count, "member index is out of range");
+            return descriptor_t::template offset_v<N>;
+        }
+
+        /**
+         * Retrieves a leaf member reference from an instance by its index.
+         * @tparam N The requested leaf member index.
+         * @param target The target instance to retrieve member reference from.
+         * @return The extracted leaf member reference.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto member(T& target) noexcept
+        -> typename reference_tuple_t::template element_t<N> {
+            using E = typename reflection_tuple_t::template element_t<N>;
+            constexpr ptrdiff_t shift = offset<N>();
+            return *reinterpret_cast<E*>(reinterpret_cast<uint8_t*>(&target) + shift);
+        }
+
+        /**
+         * Retrieves a constant leaf member reference from an instance by its index.
+         * @tparam N The requested leaf member index.
+         * @param target The target instance to retrieve member reference from.
+         * @return The extracted constant leaf member reference.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto member(const T& target) noexcept
+        -> const typename reflection_tuple_t::template element_t<N>& {
+            using E = typename reflection_tuple_t::template element_t<N>;
+            constexpr ptrdiff_t shift = offset<N>();
+            return *reinterpret_cast<const E*>(reinterpret_cast<const uint8_t*>(&target) + shift);
+        }
+
+    private:
+        /**
+         * Retrieves references to the leaves of a reflected instance.
+         * @tparam I The leaf types index sequence.
+         * @param target The reflected type instance to gather references from.
+         * @return The new reference tuple instance.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE static underlying_t extract(T& target, std::index_sequence<I...>) noexcept
+        {
+            return underlying_t(member<I>(target)...);
+        }
+};
+
+REFLECTOR_END_NAMESPACE
+
+/**
+ * Informs the size of a flat reflection tuple, allowing it to be deconstructed.
+ * @tparam T The target type for reflection.
+ * @since 1.0
+ */
+template <typename T>
+struct std::tuple_size<REFLECTOR_NAMESPACE::flat_reflection_t<T>>
+  : std::integral_constant<size_t, REFLECTOR_NAMESPACE::flat_reflection_t<T>::count> {};
+
+/**
+ * Retrieves the deconstruction type of a flat reflection tuple's element.
+ * @tparam I The index of the requested tuple element.
+ * @tparam T The target type for reflection.
+ * @since 1.0
+ */
+template <size_t I, typename T>
+struct std::tuple_element<I, REFLECTOR_NAMESPACE::flat_reflection_t<T>> {
+    using type = typename REFLECTOR_NAMESPACE::flat_reflection_t<T>::template element_t<I>;
+};
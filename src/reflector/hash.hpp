@@ -0,0 +1,203 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Reflection-based hashing and equality comparison.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <functional>
+#include <string_view>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+template <typename T> struct hash_t;
+template <typename T> struct equal_to_t;
+
+namespace detail
+{
+    /**
+     * Checks whether a type can be hashed with the standard library's hash.
+     * @tparam T The type to be checked.
+     * @since 1.0
+     */
+    template <typename T>
+    inline constexpr bool has_std_hash_v = std::is_default_constructible_v<std::hash<T>>;
+
+    /**
+     * Checks whether instances of a type can be compared with the equality operator.
+     * @tparam T The type to be checked.
+     * @since 1.0
+     */
+    template <typename T, typename = void>
+    inline constexpr bool has_equality_v = false;
+
+    template <typename T>
+    inline constexpr bool has_equality_v<T, std::void_t<
+        decltype(std::declval<const T&>() == std::declval<const T&>())>> = true;
+
+    /**
+     * Checks whether all members of a reflected type have unique object representations.
+     * @tparam T The reflected type to be checked.
+     * @tparam I The members index sequence.
+     * @return Do all members have unique object representations?
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_CONSTEXPR bool unique(std::index_sequence<I...>) noexcept
+    {
+        using reflection_tuple_t = typename reflection_t<T>::reflection_tuple_t;
+        return (std::has_unique_object_representations_v<
+            typename reflection_tuple_t::template element_t<I>> && ...);
+    }
+
+    /**
+     * Checks whether a reflected type can be hashed and compared by its bytes. That
+     * is the case when the type has no padding bytes and when equal values of each
+     * one of its members are always represented by the same bytes, which excludes,
+     * for instance, floating-point members.
+     * @tparam T The reflected type to be checked.
+     * @since 1.0
+     */
+    template <typename T>
+    inline constexpr bool bytewise_v = !reflection_t<T>::descriptor_t::has_padding
+        && unique<T>(std::make_index_sequence<reflection_t<T>::count>());
+
+    /**
+     * Hashes a single member value, recursing into reflected types when needed.
+     * @tparam E The member type to be hashed.
+     * @param value The member value to be hashed.
+     * @return The member value's hash.
+     */
+    template <typename E>
+    REFLECTOR_INLINE size_t hash(const E& value) noexcept
+    {
+        if constexpr (has_std_hash_v<E>) {
+            return std::hash<E>()(value);
+        } else {
+            return hash_t<E>()(value);
+        }
+    }
+
+    /**
+     * Compares two member values, recursing into reflected types when needed.
+     * @tparam E The member type to be compared.
+     * @param a The first member value to be compared.
+     * @param b The second member value to be compared.
+     * @return Are both values equal?
+     */
+    template <typename E>
+    REFLECTOR_INLINE bool equal(const E& a, const E& b) noexcept
+    {
+        if constexpr (has_equality_v<E>) {
+            return a == b;
+        } else {
+            return equal_to_t<E>()(a, b);
+        }
+    }
+
+    /**
+     * Hashes all bytes of an instance at once.
+     * @tparam T The type of instance to be hashed.
+     * @param value The instance to be hashed.
+     * @return The instance's hash.
+     */
+    template <typename T>
+    REFLECTOR_INLINE size_t hash_bytes(const T& value) noexcept
+    {
+        auto bytes = std::string_view(reinterpret_cast<const char*>(&value), sizeof(T));
+        return std::hash<std::string_view>()(bytes);
+    }
+
+    /**
+     * Combines the hashes of each member of a reflected instance.
+     * @tparam T The reflected type to be hashed.
+     * @tparam I The members index sequence.
+     * @param value The instance to be hashed.
+     * @return The instance's hash.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE size_t hash(const T& value, std::index_sequence<I...>) noexcept
+    {
+        size_t seed = 0;
+
+        ((seed ^= hash(reflection_t<T>::template member<I>(value))
+            + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2)), ...);
+
+        return seed;
+    }
+
+    /**
+     * Compares each member of two reflected instances.
+     * @tparam T The reflected type to be compared.
+     * @tparam I The members index sequence.
+     * @param a The first instance to be compared.
+     * @param b The second instance to be compared.
+     * @return Are both instances equal?
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE bool equal(const T& a, const T& b, std::index_sequence<I...>) noexcept
+    {
+        return (equal(
+            reflection_t<T>::template member<I>(a)
+          , reflection_t<T>::template member<I>(b)) && ...);
+    }
+}
+
+/**
+ * Hashes instances of a reflected type by combining the hashes of its members, so
+ * that reflected types can be used as keys of hash maps. Whenever the type's bytes
+ * uniquely represent its value, the type is hashed as a single block of memory.
+ * @tparam T The reflected type to be hashed.
+ * @since 1.0
+ */
+template <typename T>
+struct hash_t
+{
+    /**
+     * Hashes an instance of the reflected type.
+     * @param value The instance to be hashed.
+     * @return The instance's hash.
+     */
+    REFLECTOR_INLINE size_t operator()(const T& value) const noexcept
+    {
+        if constexpr (detail::bytewise_v<T>) {
+            return detail::hash_bytes(value);
+        } else {
+            return detail::hash(value, std::make_index_sequence<reflection_t<T>::count>());
+        }
+    }
+};
+
+/**
+ * Compares instances of a reflected type member by member. Whenever the type's bytes
+ * uniquely represent its value, instances are compared as single blocks of memory.
+ * @tparam T The reflected type to be compared.
+ * @since 1.0
+ */
+template <typename T>
+struct equal_to_t
+{
+    /**
+     * Compares two instances of the reflected type.
+     * @param a The first instance to be compared.
+     * @param b The second instance to be compared.
+     * @return Are both instances equal?
+     */
+    REFLECTOR_INLINE bool operator()(const T& a, const T& b) const noexcept
+    {
+        if constexpr (detail::bytewise_v<T>) {
+            return std::memcmp(&a, &b, sizeof(T)) == 0;
+        } else {
+            return detail::equal(a, b, std::make_index_sequence<reflection_t<T>::count>());
+        }
+    }
+};
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,235 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The memory layout analyzer for reflected types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/detail/layout.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * A hole of padding bytes within the memory layout of a reflected type.
+ * @since 1.0
+ */
+struct hole_t
+{
+    size_t offset;
+    size_t size;
+};
+
+namespace detail
+{
+    /**
+     * Lists the holes of padding bytes amongst the runs of members of a type layout,
+     * including the trailing padding bytes after its last member.
+     * @tparam M The number of holes in the memory layout.
+     * @tparam N The number of contiguous runs of members in the memory layout.
+     * @param runs The contiguous runs of members in the memory layout.
+     * @param size The total size of the laid out type.
+     * @return The holes of padding bytes in the memory layout.
+     */
+    template <size_t M, size_t N>
+    REFLECTOR_CONSTEXPR auto holes(const std::array<run_t, N>& runs, size_t size) noexcept
+    -> std::array<hole_t, M>
+    {
+        std::array<hole_t, M> result {};
+
+        for (size_t i = 0, j = 0; i < N; ++i) {
+            size_t end = runs[i].offset + runs[i].length;
+            size_t next = i + 1 < N ? runs[i + 1].offset : size;
+            if (next > end) result[j++] = hole_t {end, next - end};
+        }
+
+        return result;
+    }
+
+    /**
+     * Counts the holes of padding bytes amongst the runs of members of a type layout.
+     * @tparam N The number of contiguous runs of members in the memory layout.
+     * @param runs The contiguous runs of members in the memory layout.
+     * @param size The total size of the laid out type.
+     * @return The number of holes in the memory layout.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto count_holes(const std::array<run_t, N>& runs, size_t size) noexcept
+    -> size_t
+    {
+        size_t end = N > 0 ? runs[N - 1].offset + runs[N - 1].length : size;
+        return (N > 0 ? N - 1 : 0) + (size > end);
+    }
+
+    /**
+     * Checks whether a member occupies more than one cache line, when the laid out
+     * type starts at the beginning of a cache line.
+     * @param offset The member's offset.
+     * @param size The member's size.
+     * @return Does the member straddle a cache line boundary?
+     */
+    REFLECTOR_CONSTEXPR bool straddles(size_t offset, size_t size) noexcept
+    {
+        return size > 0 && offset / REFLECTOR_CACHE_LINE_SIZE
+            != (offset + size - 1) / REFLECTOR_CACHE_LINE_SIZE;
+    }
+
+    /**
+     * Lists the members of a type layout which straddle a cache line boundary.
+     * @tparam M The number of straddling members.
+     * @tparam N The number of members in the memory layout.
+     * @param sizes The sizes of each member.
+     * @param offsets The offsets of each member.
+     * @return The indeces of the straddling members.
+     */
+    template <size_t M, size_t N>
+    REFLECTOR_CONSTEXPR auto straddling(
+        const std::array<size_t, N>& sizes
+      , const std::array<size_t, N>& offsets
+    ) noexcept -> std::array<size_t, M>
+    {
+        std::array<size_t, M> result {};
+
+        for (size_t i = 0, j = 0; i < N; ++i)
+            if (straddles(offsets[i], sizes[i])) result[j++] = i;
+
+        return result;
+    }
+
+    /**
+     * Counts the members of a type layout which straddle a cache line boundary.
+     * @tparam N The number of members in the memory layout.
+     * @param sizes The sizes of each member.
+     * @param offsets The offsets of each member.
+     * @return The number of straddling members.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto count_straddling(
+        const std::array<size_t, N>& sizes
+      , const std::array<size_t, N>& offsets
+    ) noexcept -> size_t
+    {
+        size_t count = 0;
+
+        for (size_t i = 0; i < N; ++i)
+            count += straddles(offsets[i], sizes[i]);
+
+        return count;
+    }
+
+    /**
+     * Sorts the members of a type layout by decreasing alignment requirements. The
+     * relative order of members with the same alignment is preserved, so that the
+     * elements of flattened array members are never split apart.
+     * @tparam N The number of members in the memory layout.
+     * @param alignments The alignment requirements of each member.
+     * @return The members' indeces permutation.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto reorder(const std::array<size_t, N>& alignments) noexcept
+    -> std::array<size_t, N>
+    {
+        std::array<size_t, N> order {};
+
+        for (size_t i = 0; i < N; ++i) {
+            size_t j = i;
+            for (; j > 0 && alignments[order[j - 1]] < alignments[i]; --j)
+                order[j] = order[j - 1];
+            order[j] = i;
+        }
+
+        return order;
+    }
+
+    /**
+     * Computes the size of a type with its members laid out in the given order.
+     * @tparam N The number of members in the memory layout.
+     * @param order The order in which the members are laid out.
+     * @param sizes The sizes of each member.
+     * @param alignments The alignment requirements of each member.
+     * @param alignment The alignment requirement of the laid out type.
+     * @return The size of the laid out type.
+     */
+    template <size_t N>
+    REFLECTOR_CONSTEXPR auto resize(
+        const std::array<size_t, N>& order
+      , const std::array<size_t, N>& sizes
+      , const std::array<size_t, N>& alignments
+      , size_t alignment
+    ) noexcept -> size_t
+    {
+        std::array<size_t, N> psizes {}, paligns {};
+
+        for (size_t i = 0; i < N; ++i) {
+            psizes[i] = sizes[order[i]];
+            paligns[i] = alignments[order[i]];
+        }
+
+        auto offsets = layout(psizes, paligns);
+        size_t end = N > 0 ? offsets[N - 1] + psizes[N - 1] : 0;
+
+        return end > 0 ? (end + alignment - 1) / alignment * alignment : 1;
+    }
+}
+
+/**
+ * Reports the memory layout of a reflected type, as computed from its descriptor.
+ * The report informs the type's padding bytes and where they are, which members
+ * straddle cache line boundaries, and a reordering of the type's members which
+ * minimizes its size. As the whole report is computed at compile-time, it can be
+ * used within static assertions to guard the layout of performance-sensitive types.
+ * Members of nested types are not analysed, as these are treated as opaque members.
+ * @tparam T The reflected type to be analysed.
+ * @since 1.0
+ */
+template <typename T>
+struct layout_info_t
+{
+    private:
+        typedef typename reflection_t<T>::descriptor_t descriptor_t;
+
+    public:
+        static constexpr size_t count = descriptor_t::count;
+        static constexpr size_t size = sizeof(T);
+        static constexpr size_t padding = sizeof(T) - descriptor_t::packed_size;
+
+        /**
+         * The holes of padding bytes in the type, including its trailing padding.
+         * @since 1.0
+         */
+        static constexpr std::array<hole_t, detail::count_holes(descriptor_t::runs, sizeof(T))> holes
+            = detail::holes<detail::count_holes(descriptor_t::runs, sizeof(T))>(descriptor_t::runs, sizeof(T));
+
+        /**
+         * The indeces of members which straddle a cache line boundary, considering
+         * that instances of the type are aligned to the beginning of a cache line.
+         * @since 1.0
+         */
+        static constexpr std::array<size_t, detail::count_straddling(descriptor_t::sizes, descriptor_t::offsets)>
+            straddling = detail::straddling<detail::count_straddling(descriptor_t::sizes, descriptor_t::offsets)>(
+                descriptor_t::sizes, descriptor_t::offsets);
+
+        /**
+         * The permutation of the type's members which minimizes its size, and the size
+         * the type would have if its members were declared in such order.
+         * @since 1.0
+         */
+        static constexpr std::array<size_t, count> packed_order = detail::reorder(descriptor_t::alignments);
+        static constexpr size_t packed_size = detail::resize(
+            packed_order, descriptor_t::sizes, descriptor_t::alignments, alignof(T));
+};
+
+/**
+ * The permutation of a reflected type's members which minimizes its size.
+ * @tparam T The reflected type to be analysed.
+ * @since 1.0
+ */
+template <typename T>
+inline constexpr auto packed_order_v = layout_info_t<T>::packed_order;
+
+REFLECTOR_END_NAMESPACE
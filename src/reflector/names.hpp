@@ -0,0 +1,93 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Compile-time access to the names of reflected members.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * The index returned when a member name cannot be found.
+ * @since 1.0
+ */
+inline constexpr size_t npos = static_cast<size_t>(-1);
+
+namespace detail
+{
+    /**
+     * Checks whether a descriptor records the names of its type's members.
+     * @tparam D The descriptor type to be checked.
+     * @since 1.0
+     */
+    template <typename D, typename = void>
+    inline constexpr bool named_v = false;
+
+    template <typename D>
+    inline constexpr bool named_v<D, std::void_t<decltype(D::block)>> = true;
+}
+
+/**
+ * Checks whether the names of a reflected type's members are known. Names are only
+ * known for types whose members have been listed with a named provider.
+ * @tparam T The reflected type to be checked.
+ * @since 1.0
+ */
+template <typename T>
+inline constexpr bool has_member_names_v = detail::named_v<typename reflection_t<T>::descriptor_t>;
+
+/**
+ * Retrieves the name of a reflected type's member. As array members are flattened,
+ * all elements of an array member share the same name.
+ * @tparam T The reflected type to retrieve a member name from.
+ * @param index The index of the requested member.
+ * @return The member's name, or an empty name if the index is out of range.
+ */
+template <typename T>
+REFLECTOR_CONSTEXPR auto member_name(size_t index) noexcept -> std::string_view
+{
+    using descriptor_t = typename reflection_t<T>::descriptor_t;
+    static_assert(has_member_names_v<T>, "the reflected type's member names are not known");
+
+    if (index >= descriptor_t::count)
+        return std::string_view();
+
+    const auto& name = descriptor_t::names[descriptor_t::member_of[index]];
+    return descriptor_t::block.substr(name.offset, name.length);
+}
+
+/**
+ * Finds the index of a reflected type's member by its name. The name is looked up
+ * through a perfect hash, so that no matter the number of members in the type, only
+ * a single name comparison is needed. For array members, the index of their first
+ * element is returned.
+ * @tparam T The reflected type to find a member from.
+ * @param name The name of the requested member.
+ * @return The member's index, or npos if there is no member with such name.
+ */
+template <typename T>
+REFLECTOR_CONSTEXPR auto member_index(std::string_view name) noexcept -> size_t
+{
+    using descriptor_t = typename reflection_t<T>::descriptor_t;
+    static_assert(has_member_names_v<T>, "the reflected type's member names are not known");
+
+    const size_t entry = descriptor_t::hash.table[descriptor_t::hash.slot(name)];
+
+    if (entry == 0)
+        return npos;
+
+    const auto& candidate = descriptor_t::names[entry - 1];
+    return descriptor_t::block.substr(candidate.offset, candidate.length) == name
+        ? descriptor_t::first_of[entry - 1]
+        : npos;
+}
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,340 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The columnar text parser for reflected types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <charconv>
+#include <algorithm>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/soa.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * Enumerates the possible outcomes of parsing rows of text.
+ * @since 1.0
+ */
+enum class parse_status_t
+{
+    success = 0
+  , invalid_field
+  , missing_field
+  , excess_field
+};
+
+/**
+ * Reports the outcome of parsing rows of text into a container. When parsing fails,
+ * all rows preceding the failing one are kept in the container, and the reported
+ * position points to the start of the failing row.
+ * @since 1.0
+ */
+struct parse_result_t
+{
+    size_t rows = 0;
+    size_t consumed = 0;
+    size_t field = 0;
+    parse_status_t status = parse_status_t::success;
+
+    /**
+     * Informs whether all rows in the buffer have been successfully parsed.
+     * @return Has the buffer been entirely parsed?
+     */
+    REFLECTOR_CONSTEXPR explicit operator bool() const noexcept
+    {
+        return status == parse_status_t::success;
+    }
+};
+
+namespace detail
+{
+    /**
+     * Removes the leading and trailing blank spaces from a text field.
+     * @param field The field to be trimmed.
+     * @return The trimmed field.
+     */
+    REFLECTOR_CONSTEXPR std::string_view trim(std::string_view field) noexcept
+    {
+        const size_t first = field.find_first_not_of(' ');
+        const size_t last = field.find_last_not_of(' ');
+        return first == std::string_view::npos
+            ? std::string_view()
+            : field.substr(first, last - first + 1);
+    }
+
+    /**
+     * Parses a text field into a value of the member's type. The parsing kernel is
+     * selected at compile time from the type of the member being parsed.
+     * @tparam R The type of the member to be parsed.
+     * @param field The text field to be parsed.
+     * @param value The member to be parsed into.
+     * @return Has the whole field been successfully parsed?
+     */
+    template <typename R>
+    REFLECTOR_INLINE bool parse_field(std::string_view field, R& value) noexcept
+    {
+        const char *first = field.data();
+        const char *last = field.data() + field.size();
+
+        if constexpr (std::is_same_v<R, char>) {
+            return field.size() == 1 && (value = field.front(), true);
+        } else if constexpr (std::is_same_v<R, bool>) {
+            if (field == "1" || field == "true") return value = true, true;
+            if (field == "0" || field == "false") return value = false, true;
+            return false;
+        } else if constexpr (std::is_enum_v<R>) {
+            std::underlying_type_t<R> underlying;
+            return parse_field(field, underlying) && (value = static_cast<R>(underlying), true);
+        } else if constexpr (std::is_arithmetic_v<R>) {
+            const auto [ptr, error] = std::from_chars(first, last, value);
+            return error == std::errc() && ptr == last;
+        } else {
+            static_assert(!sizeof(R), "the member type cannot be parsed from text");
+        }
+    }
+
+    /**
+     * Splits a row into fields separated by a delimiter character.
+     * @since 1.0
+     */
+    struct delimited_t
+    {
+        char delimiter;
+
+        /**
+         * Extracts the next field from a row.
+         * @param row The row to extract a field from.
+         * @param position The position of the next field within the row.
+         * @param field The extracted field.
+         * @return Is there a field left in the row?
+         */
+        REFLECTOR_CONSTEXPR bool next(
+            std::string_view row
+          , size_t& position
+          , size_t
+          , std::string_view& field
+        ) const noexcept {
+            if (position > row.size())
+                return false;
+            const size_t end = std::min(row.find(delimiter, position), row.size());
+            field = row.substr(position, end - position);
+            position = end + 1;
+            return true;
+        }
+
+        /**
+         * Checks whether a row has been entirely consumed.
+         * @param row The row being parsed.
+         * @param position The position of the next field within the row.
+         * @return Are there no fields left in the row?
+         */
+        REFLECTOR_CONSTEXPR bool finished(std::string_view row, size_t position) const noexcept
+        {
+            return position > row.size();
+        }
+    };
+
+    /**
+     * Splits a row into fields with fixed widths. Fields are padded with spaces.
+     * @tparam N The number of fields in a row.
+     * @since 1.0
+     */
+    template <size_t N>
+    struct fixed_width_t
+    {
+        const std::array<size_t, N>& widths;
+
+        /**
+         * Extracts the next field from a row.
+         * @param row The row to extract a field from.
+         * @param position The position of the next field within the row.
+         * @param index The index of the field to be extracted.
+         * @param field The extracted field.
+         * @return Is there a field left in the row?
+         */
+        REFLECTOR_CONSTEXPR bool next(
+            std::string_view row
+          , size_t& position
+          , size_t index
+          , std::string_view& field
+        ) const noexcept {
+            if (position >= row.size())
+                return false;
+            field = trim(row.substr(position, widths[index]));
+            position += widths[index];
+            return true;
+        }
+
+        /**
+         * Checks whether a row has been entirely consumed.
+         * @param row The row being parsed.
+         * @param position The position of the next field within the row.
+         * @return Are there no fields left in the row?
+         */
+        REFLECTOR_CONSTEXPR bool finished(std::string_view row, size_t position) const noexcept
+        {
+            return position >= row.size() || trim(row.substr(position)).empty();
+        }
+    };
+
+    /**
+     * Parses a field of a row directly into its member column.
+     * @tparam I The index of the member to be parsed.
+     * @tparam T The reflected type to be parsed.
+     * @tparam S The row splitter type.
+     * @param splitter The row splitter.
+     * @param row The row being parsed.
+     * @param position The position of the next field within the row.
+     * @param target The container to parse the field into.
+     * @param index The index of the instance being parsed.
+     * @param result The parsing result to report failures into.
+     * @return Has the field been successfully parsed?
+     */
+    template <size_t I, typename T, typename S>
+    REFLECTOR_INLINE bool parse_column(
+        const S& splitter
+      , std::string_view row
+      , size_t& position
+      , soa_vector_t<T>& target
+      , size_t index
+      , parse_result_t& result
+    ) noexcept {
+        std::string_view field;
+        result.field = I;
+
+        if (!splitter.next(row, position, I, field))
+            return result.status = parse_status_t::missing_field, false;
+        if (!parse_field(field, supertuple::get<I>(target[index])))
+            return result.status = parse_status_t::invalid_field, false;
+
+        return true;
+    }
+
+    /**
+     * Parses a row into an instance stored in the container.
+     * @tparam T The reflected type to be parsed.
+     * @tparam S The row splitter type.
+     * @tparam I The member columns index sequence.
+     * @param splitter The row splitter.
+     * @param row The row to be parsed.
+     * @param target The container to parse the row into.
+     * @param index The index of the instance being parsed.
+     * @param result The parsing result to report failures into.
+     * @return Has the row been successfully parsed?
+     */
+    template <typename T, typename S, size_t ...I>
+    REFLECTOR_INLINE bool parse_row(
+        const S& splitter
+      , std::string_view row
+      , soa_vector_t<T>& target
+      , size_t index
+      , parse_result_t& result
+      , std::index_sequence<I...>
+    ) noexcept {
+        size_t position = 0;
+
+        if (!(parse_column<I>(splitter, row, position, target, index, result) && ...))
+            return false;
+        if (!splitter.finished(row, position))
+            return result.status = parse_status_t::excess_field, false;
+
+        return true;
+    }
+
+    /**
+     * Parses the rows of a text buffer into a struct-of-arrays container. Empty
+     * rows are skipped, and line-feed, carriage-return and carriage-return followed
+     * by line-feed line endings are all accepted. Room for all rows is reserved
+     * upfront with a single scan for line breaks, so no allocations happen while
+     * fields are parsed.
+     * @tparam T The reflected type to be parsed.
+     * @tparam S The row splitter type.
+     * @param buffer The text buffer to be parsed.
+     * @param target The container to append the parsed instances to.
+     * @param splitter The row splitter.
+     * @return The parsing result.
+     */
+    template <typename T, typename S>
+    REFLECTOR_INLINE parse_result_t parse_rows(
+        std::string_view buffer
+      , soa_vector_t<T>& target
+      , const S& splitter
+    ) {
+        parse_result_t result;
+        const size_t initial = target.size();
+
+        const auto newline = [](char c) { return c == '\n' || c == '\r'; };
+        const size_t bound = static_cast<size_t>(std::count_if(buffer.begin(), buffer.end(), newline))
+            + (!buffer.empty() && !newline(buffer.back()));
+
+        target.resize(initial + bound);
+
+        while (result.consumed < buffer.size()) {
+            const size_t end = std::min(buffer.find_first_of("\r\n", result.consumed), buffer.size());
+            const std::string_view row = buffer.substr(result.consumed, end - result.consumed);
+            const bool crlf = buffer.compare(end, 2, "\r\n") == 0;
+
+            if (!row.empty()) {
+                constexpr auto sequence = std::make_index_sequence<soa_vector_t<T>::count>();
+                if (!parse_row(splitter, row, target, initial + result.rows, result, sequence))
+                    break;
+                ++result.rows;
+            }
+
+            result.consumed = std::min(end + 1 + crlf, buffer.size());
+        }
+
+        target.resize(initial + result.rows);
+        return result;
+    }
+}
+
+/**
+ * Parses rows of delimited text into a struct-of-arrays container. Each row must
+ * contain exactly one field per property member of the reflected type, in order,
+ * with array members contributing one field per element. Fields are converted in
+ * place into the container's columns, without intermediate strings.
+ * @tparam T The reflected type to be parsed.
+ * @param buffer The text buffer to be parsed.
+ * @param target The container to append the parsed instances to.
+ * @param delimiter The character separating fields within a row.
+ * @return The parsing result.
+ */
+template <typename T>
+REFLECTOR_INLINE parse_result_t parse_rows(
+    std::string_view buffer
+  , soa_vector_t<T>& target
+  , char delimiter = ','
+) {
+    return detail::parse_rows(buffer, target, detail::delimited_t {delimiter});
+}
+
+/**
+ * Parses rows of fixed-width text into a struct-of-arrays container. Each field is
+ * taken from a fixed number of characters, with surrounding spaces ignored.
+ * @tparam T The reflected type to be parsed.
+ * @param buffer The text buffer to be parsed.
+ * @param target The container to append the parsed instances to.
+ * @param widths The number of characters taken by each field.
+ * @return The parsing result.
+ */
+template <typename T>
+REFLECTOR_INLINE parse_result_t parse_rows(
+    std::string_view buffer
+  , soa_vector_t<T>& target
+  , const std::array<size_t, soa_vector_t<T>::count>& widths
+) {
+    using splitter_t = detail::fixed_width_t<soa_vector_t<T>::count>;
+    return detail::parse_rows(buffer, target, splitter_t {widths});
+}
+
+REFLECTOR_END_NAMESPACE
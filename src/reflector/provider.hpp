@@ -6,17 +6,19 @@
  */
 #pragma once
 
+#include <array>
+#include <cstddef>
 #include <utility>
-#include <supertuple.h>
+#include <string_view>
+#include <type_traits>
 
 #include <reflector/environment.h>
+#include <reflector/detail/tuple.hpp>
 #include <reflector/detail/loophole.hpp>
 #include <reflector/detail/descriptor.hpp>
 
 REFLECTOR_BEGIN_NAMESPACE
 
-namespace supertuple = ::SUPERTUPLE_NAMESPACE;
-
 /**
  * The reflection provider for a specified type. A custom, and possibly generic,
  * provider can be specified by specializing it to the reflected type.
@@ -53,16 +55,32 @@ struct provider_t
 namespace detail
 {
     /**
-     * Flattens an unary tuple by its array elements.
-     * @tparam T The unary tuple type to be flattened.
-     * @return The flattened unary tuple type.
+     * Flattens the array members of a type into a single list of member types. Each
+     * flattened member type is directly selected from its owner declared member, so
+     * that the list is produced in a single step, rather than by concatenating the
+     * flattened arrays one after another.
+     * @tparam R The declared member types of the type.
+     * @since 1.0
      */
-    template <
-        typename T
-      , typename E = std::remove_all_extents_t<T>
-      , size_t N   = sizeof(T) / sizeof(E)>
-    REFLECTOR_CONSTEXPR auto flatten(supertuple::tuple_t<T>) noexcept
-    -> typename supertuple::ntuple_t<E, N>::base_tuple_t;
+    template <typename ...R>
+    struct flattener_t
+    {
+        using indexer_type = indexer_t<std::index_sequence_for<R...>, R...>;
+
+        static constexpr std::array<size_t, sizeof...(R)> extents
+            = {(sizeof(R) / sizeof(std::remove_all_extents_t<R>))...};
+        static constexpr size_t count
+            = (0 + ... + (sizeof(R) / sizeof(std::remove_all_extents_t<R>)));
+        static constexpr std::array<size_t, count> owner_of
+            = detail::unflatten<count>(extents);
+
+        template <size_t ...J>
+        static auto flatten(std::index_sequence<J...>) noexcept -> supertuple::tuple_t<
+            std::remove_all_extents_t<typename decltype(
+                detail::select<owner_of[J]>(std::declval<indexer_type>()))::type>...>;
+
+        using type = decltype(flatten(std::make_index_sequence<count>()));
+    };
 }
 
 /**
@@ -74,26 +92,88 @@ namespace detail
 template <typename T, typename ...R>
 REFLECTOR_CONSTEXPR auto provide(R T::*...) noexcept
 {
-    using namespace supertuple;
-
     // When a type is reflected via the loophole mechanism, array fields present
     // in the type are flattened, effectivelly creating a different index for each
     // element of each array field. On the other hand, when the type's fields are
     // manually provided, these array fields become a single index in the reflection.
     // This behaviour difference is not useful. Therefore, we must flatten these
     // array fields to produce consistent behaviour between different mechanisms.
+    return detail::descriptor_t<T, typename detail::flattener_t<R...>::type>();
+}
 
-    constexpr auto concatenate = [](auto a, auto b) {
-        return supertuple::concat(a, b);
-    };
+/**
+ * Provides the properties' description of a reflectible type, along with the names
+ * of its properties. The names are given by a type with a static string of the names
+ * of each member, separated by commas, in declaration order. Each name may also be
+ * given as a qualified member pointer, so that the names can be produced directly by
+ * stringifying the list of member pointers.
+ * @tparam N The type holding the comma-separated list of member names.
+ * @tparam T The type to be described and reflected over.
+ * @tparam R The properties' types of the target reflection type.
+ * @return The target type named descriptor instance.
+ */
+template <
+    typename N, typename T, typename ...R
+  , typename = std::enable_if_t<!std::is_member_pointer_v<N>>>
+REFLECTOR_CONSTEXPR auto provide(N, R T::*...) noexcept
+{
+    using descriptor_t = decltype(provide(static_cast<R T::*>(nullptr)...));
 
-    using loophole_tuple_t = decltype(
-        supertuple::foldl(
-            tuple_t<decltype(detail::flatten(tuple_t<R>()))...>()
-          , concatenate
-        ));
+    return detail::named_descriptor_t<
+        T, typename descriptor_t::reflection_tuple_t, N
+      , std::index_sequence<(sizeof(R) / sizeof(std::remove_all_extents_t<R>))...>>();
+}
 
-    return detail::descriptor_t<T, std::decay_t<loophole_tuple_t>>();
+/**
+ * Provides the properties' description of a reflectible type from its member pointers,
+ * given as template arguments. As the member pointers are then known at compile-time,
+ * the described members can also be accessed within constant expressions.
+ * @tparam P The pointers to each member of the reflected type, in declaration order.
+ * @return The target type descriptor instance.
+ */
+template <auto ...P, typename = std::enable_if_t<(std::is_member_object_pointer_v<decltype(P)> && ...)>>
+REFLECTOR_CONSTEXPR auto provide() noexcept
+{
+    return detail::member_descriptor_t<decltype(provide(P...)), P...>();
+}
+
+/**
+ * Provides the properties' description of a reflectible type from its member pointers,
+ * given as template arguments, along with the names of its properties.
+ * @tparam N The type holding the comma-separated list of member names.
+ * @tparam P The pointers to each member of the reflected type, in declaration order.
+ * @return The target type named descriptor instance.
+ */
+template <typename N, auto ...P>
+REFLECTOR_CONSTEXPR auto provide() noexcept
+{
+    return detail::member_descriptor_t<decltype(provide(N(), P...)), P...>();
 }
 
 REFLECTOR_END_NAMESPACE
+
+/**
+ * Declares the reflection of a type by explicitly listing its members. This macro must
+ * be used in the global namespace, right after the type's definition, and produces
+ * an explicit specialization of the type's provider. Therefore, every translation unit
+ * that includes the type's definition will use the given members' list rather than
+ * running the automatic reflection mechanism. The names of the members are recorded
+ * from the given members' list as well. As members are accessed through the given
+ * member pointers, they can be accessed within constant expressions.
+ * @param T The type to be reflected.
+ * @param ... The pointers to each member of the reflected type, in declaration order.
+ * @since 1.0
+ */
+#define REFLECTOR_DECLARE(T, ...)                                               \
+    template <>                                                                 \
+    struct REFLECTOR_NAMESPACE::provider_t<T>                                   \
+    {                                                                           \
+        struct names_t {                                                        \
+            static constexpr std::string_view value = #__VA_ARGS__;             \
+        };                                                                      \
+                                                                                \
+        REFLECTOR_CONSTEXPR static auto provide() noexcept                      \
+        {                                                                       \
+            return REFLECTOR_NAMESPACE::provide<names_t, __VA_ARGS__>();        \
+        }                                                                       \
+    };
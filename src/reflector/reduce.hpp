@@ -0,0 +1,291 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Parallel member-wise reductions over batches of reflected instances.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <limits>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/detail/tuple.hpp>
+#include <reflector/reflector.hpp>
+#include <reflector/algorithm.hpp>
+#include <reflector/span.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Picks the type in which the values of an arithmetic member are summed, so that
+     * sums over large batches do not overflow the member's own type.
+     * @tparam E The arithmetic member type to be summed.
+     * @since 1.0
+     */
+    template <typename E>
+    using sum_t = std::conditional_t<
+        std::is_floating_point_v<E>, std::common_type_t<E, double>
+      , std::conditional_t<std::is_signed_v<E>, int64_t, uint64_t>>;
+}
+
+/**
+ * The aggregates of a member over a batch of instances. Members of non-arithmetic
+ * types are not aggregated, and thus have an empty aggregate.
+ * @tparam E The member type to be aggregated.
+ * @since 1.0
+ */
+template <typename E, typename = void>
+struct aggregate_t
+{
+    REFLECTOR_CONSTEXPR void combine(const aggregate_t&) noexcept {}
+};
+
+/**
+ * The aggregates of an arithmetic member over a batch of instances. An empty batch
+ * has a zero sum, its minimum is the type's largest value and its maximum is the
+ * type's lowest value, so that combining it with any other aggregate is a no-op.
+ * @tparam E The arithmetic member type to be aggregated.
+ * @since 1.0
+ */
+template <typename E>
+struct aggregate_t<E, std::enable_if_t<std::is_arithmetic_v<E>>>
+{
+    size_t count = 0;
+    detail::sum_t<E> sum = 0;
+    E min = std::numeric_limits<E>::max();
+    E max = std::numeric_limits<E>::lowest();
+
+    /**
+     * Combines the aggregates of another batch into the current one.
+     * @param other The aggregates to be combined.
+     */
+    REFLECTOR_CONSTEXPR void combine(const aggregate_t& other) noexcept
+    {
+        count += other.count;
+        sum += other.sum;
+        min = other.min < min ? other.min : min;
+        max = other.max > max ? other.max : max;
+    }
+};
+
+namespace detail
+{
+    /**
+     * Produces the accumulator of the aggregates of every member of a reflected type.
+     * @tparam T The reflected type to be aggregated.
+     * @since 1.0
+     */
+    template <typename T, typename = typename reflection_t<T>::reflection_tuple_t>
+    struct accumulator_t;
+
+    /**
+     * Produces the accumulator of the aggregates of every member of a reflected type.
+     * @tparam T The reflected type to be aggregated.
+     * @tparam E The reflected type's member types.
+     * @since 1.0
+     */
+    template <typename T, typename ...E>
+    struct accumulator_t<T, supertuple::tuple_t<E...>>
+    {
+        using type = supertuple::tuple_t<aggregate_t<E>...>;
+    };
+}
+
+/**
+ * The accumulator of the aggregates of every member of a reflected type, in the same
+ * order as the type's members are declared.
+ * @tparam T The reflected type to be aggregated.
+ * @since 1.0
+ */
+template <typename T>
+using aggregates_t = typename detail::accumulator_t<T>::type;
+
+/**
+ * Runs the jobs of a reduction on the calling thread. Executors must inform how many
+ * jobs they can run concurrently, and run a number of jobs, returning only when all
+ * of them have finished. Any thread pool can be adapted to this interface.
+ * @since 1.0
+ */
+struct inline_executor_t
+{
+    REFLECTOR_CONSTEXPR size_t concurrency() const noexcept
+    {
+        return 1;
+    }
+
+    template <typename F>
+    REFLECTOR_INLINE void operator()(size_t jobs, F& job) const
+    {
+        for (size_t i = 0; i < jobs; ++i)
+            job(i);
+    }
+};
+
+/**
+ * Runs the jobs of a reduction on freshly spawned threads, one per job. The calling
+ * thread runs the first job itself while waiting for the others to finish.
+ * @since 1.0
+ */
+class thread_executor_t
+{
+    private:
+        size_t m_threads;
+
+    public:
+        /**
+         * Creates an executor limited to a number of concurrent threads.
+         * @param threads The maximum number of threads to run jobs on.
+         */
+        REFLECTOR_INLINE explicit thread_executor_t(
+            size_t threads = std::thread::hardware_concurrency()
+        ) noexcept
+          : m_threads (threads > 0 ? threads : 1)
+        {}
+
+        REFLECTOR_INLINE size_t concurrency() const noexcept
+        {
+            return m_threads;
+        }
+
+        template <typename F>
+        REFLECTOR_INLINE void operator()(size_t jobs, F& job) const
+        {
+            std::vector<std::thread> workers;
+            workers.reserve(jobs > 0 ? jobs - 1 : 0);
+
+            for (size_t i = 1; i < jobs; ++i)
+                workers.emplace_back([&job, i]() { job(i); });
+
+            if (jobs > 0) job(0);
+            for (auto& worker : workers) worker.join();
+        }
+};
+
+namespace detail
+{
+    /**
+     * A partial accumulator owned by a single job of a reduction. Each accumulator
+     * occupies its own cache lines, so that jobs do not falsely share them.
+     * @tparam T The reflected type to be aggregated.
+     * @since 1.0
+     */
+    template <typename T>
+    struct alignas(REFLECTOR_CACHE_LINE_SIZE) partial_t
+    {
+        aggregates_t<T> value;
+    };
+
+    /**
+     * Aggregates one member of every instance in a batch. The member's aggregates are
+     * kept locally while the batch is iterated with a fixed stride, so that the loop
+     * can be vectorized, and are only written to the accumulator at the end.
+     * @tparam N The index of the member to be aggregated.
+     * @tparam T The reflected type of the batch's instances.
+     * @tparam A The type of the member's aggregate.
+     * @param batch The batch of instances to be aggregated.
+     * @param target The aggregate to write the member's aggregates into.
+     */
+    template <size_t N, typename T, typename A>
+    REFLECTOR_INLINE void aggregate_member(span_t<const T> batch, A& target) noexcept
+    {
+        using E = typename reflection_t<T>::reflection_tuple_t::template element_t<N>;
+
+        if constexpr (std::is_arithmetic_v<E>) {
+            auto base = reinterpret_cast<const uint8_t*>(batch.data());
+            auto result = aggregate_t<E>();
+
+            for (size_t i = 0; i < batch.size(); ++i) {
+                const E value = strided<N, const T>(base, i);
+                result.sum += value;
+                result.min = value < result.min ? value : result.min;
+                result.max = value > result.max ? value : result.max;
+            }
+
+            result.count = batch.size();
+            target = result;
+        }
+    }
+
+    /**
+     * Aggregates every member of every instance in a batch.
+     * @tparam T The reflected type of the batch's instances.
+     * @tparam I The members index sequence.
+     * @param batch The batch of instances to be aggregated.
+     * @param target The accumulator to write the aggregates into.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE void aggregate(span_t<const T> batch, aggregates_t<T>& target, std::index_sequence<I...>) noexcept
+    {
+        (aggregate_member<I>(batch, supertuple::get<I>(target)), ...);
+    }
+
+    /**
+     * Combines the aggregates of every member of a batch into an accumulator.
+     * @tparam T The reflected type to be aggregated.
+     * @tparam I The members index sequence.
+     * @param target The accumulator to combine the aggregates into.
+     * @param source The aggregates to be combined.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE void combine(aggregates_t<T>& target, const aggregates_t<T>& source, std::index_sequence<I...>) noexcept
+    {
+        (supertuple::get<I>(target).combine(supertuple::get<I>(source)), ...);
+    }
+}
+
+/**
+ * Computes the count, sum, minimum and maximum of every arithmetic member over a batch
+ * of instances in a single pass. The batch is split into contiguous chunks of at least
+ * a grain of instances, each one reduced by a job of the given executor into its own
+ * partial accumulator, which are then combined in order. Therefore, for a given number
+ * of jobs, the results are deterministic even for floating-point members.
+ * @tparam T The reflected type of the batch's instances.
+ * @tparam X The type of the executor to run the reduction's jobs.
+ * @param batch The batch of instances to be reduced.
+ * @param executor The executor to run the reduction's jobs.
+ * @param grain The minimum number of instances to be reduced by a job.
+ * @return The aggregates of every member over the batch.
+ */
+template <typename T, typename X = inline_executor_t>
+REFLECTOR_INLINE aggregates_t<T> reduce_fields(
+    span_t<const T> batch
+  , X&& executor = X()
+  , size_t grain = 4096
+) {
+    constexpr auto members = std::make_index_sequence<reflection_t<T>::count>();
+
+    const size_t ideal = (batch.size() + (grain > 0 ? grain : 1) - 1) / (grain > 0 ? grain : 1);
+    const size_t jobs = ideal < executor.concurrency() ? ideal : executor.concurrency();
+
+    if (jobs <= 1) {
+        auto result = aggregates_t<T>();
+        detail::aggregate(batch, result, members);
+        return result;
+    }
+
+    auto partials = std::vector<detail::partial_t<T>>(jobs);
+    const size_t chunk = (batch.size() + jobs - 1) / jobs;
+
+    auto job = [&](size_t i) {
+        const size_t first = i * chunk < batch.size() ? i * chunk : batch.size();
+        const size_t count = batch.size() - first < chunk ? batch.size() - first : chunk;
+        detail::aggregate(batch.subspan(first, count), partials[i].value, members);
+    };
+
+    executor(jobs, job);
+
+    for (size_t i = 1; i < jobs; ++i)
+        detail::combine<T>(partials[0].value, partials[i].value, members);
+
+    return partials[0].value;
+}
+
+REFLECTOR_END_NAMESPACE
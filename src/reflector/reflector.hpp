@@ -6,13 +6,46 @@
  */
 #pragma once
 
+#include <cstddef>
 #include <utility>
+#include <type_traits>
 
 #include <reflector/environment.h>
 #include <reflector/provider.hpp>
+#include <reflector/span.hpp>
+
+#if REFLECTOR_TRACE_ENABLED
+  #include <reflector/trace.hpp>
+#endif
+
+#if REFLECTOR_CPP_DIALECT >= 2020 && __has_include(<bit>)
+  #include <bit>
+#endif
 
 REFLECTOR_BEGIN_NAMESPACE
 
+namespace detail
+{
+    /**
+     * Checks whether a descriptor keeps the pointers to its type's members.
+     * @tparam D The descriptor type to be checked.
+     * @since 1.0
+     */
+    template <typename D, typename = void>
+    inline constexpr bool has_member_pointers_v = false;
+
+    template <typename D>
+    inline constexpr bool has_member_pointers_v<D, std::void_t<decltype(D::has_member_pointers)>> = true;
+}
+
+/*
+ * Forward declaration of the reflection overlay type, which reflects over a raw
+ * memory buffer as if it held an instance of the target type.
+ * @since 1.0
+ */
+template <typename T>
+class overlay_t;
+
 /**
  * Extracts and manages references to each member property of the target type, thus
  * enumerating each of the target type's property members and allowing them to be
@@ -38,6 +71,7 @@ class reflection_t : public decltype(provider_t<T>::provide())::reference_tuple_
       , "the produced reflection type is incompatible with the target type");
 
     public:
+        using descriptor_t = provider_t;
         using reference_tuple_t = underlying_t;
         using reflection_tuple_t = typename provider_t::reflection_tuple_t;
 
@@ -52,7 +86,9 @@ class reflection_t : public decltype(provider_t<T>::provide())::reference_tuple_
          */
         REFLECTOR_INLINE reflection_t(T& target) noexcept
           : underlying_t (extract(target, std::make_index_sequence<underlying_t::count>()))
-        {}
+        {
+            REFLECTOR_TRACE_INSTANCE(T, provider_t);
+        }
 
         REFLECTOR_INLINE reflection_t& operator=(const reflection_t&) = default;
         REFLECTOR_INLINE reflection_t& operator=(reflection_t&&) = default;
@@ -66,13 +102,14 @@ class reflection_t : public decltype(provider_t<T>::provide())::reference_tuple_
         template <size_t N>
         REFLECTOR_CONSTEXPR static auto offset() noexcept -> ptrdiff_t
         {
-            constexpr typename provider_t::storage_tuple_t s {};
-            return reinterpret_cast<size_t>(&s.template get<N>())
-                -  reinterpret_cast<size_t>(&s.template get<0>());
+            static_assert(N < provider_t::count, "member index is out of range");
+            return provider_t::template offset_v<N>;
         }
 
         /**
-         * Retrieves a property member reference from an instance by its index.
+         * Retrieves a property member reference from an instance by its index. When the
+         * type's member pointers are known, the member is accessed through its pointer,
+         * which is also valid within constant expressions.
          * @tparam N The requested property member index.
          * @param target The target instance to retrieve member reference from.
          * @return The extracted member reference.
@@ -80,11 +117,131 @@ class reflection_t : public decltype(provider_t<T>::provide())::reference_tuple_
         template <size_t N>
         REFLECTOR_CONSTEXPR static auto member(T& target) noexcept
         -> typename reference_tuple_t::template element_t<N> {
-            using E = typename reflection_tuple_t::template element_t<N>;
-            return *reinterpret_cast<E*>(reinterpret_cast<uint8_t*>(&target) + offset<N>());
+            REFLECTOR_TRACE_ACCESS(T, provider_t, N);
+            return locate<N>(target);
+        }
+
+        /**
+         * Retrieves a constant property member reference from an instance by its index.
+         * @tparam N The requested property member index.
+         * @param target The target instance to retrieve member reference from.
+         * @return The extracted constant member reference.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto member(const T& target) noexcept
+        -> const typename reflection_tuple_t::template element_t<N>& {
+            REFLECTOR_TRACE_ACCESS(T, provider_t, N);
+            return locate<N>(target);
+        }
+
+        /**
+         * Retrieves the value of a property member from an instance by its index. Unlike
+         * member references, values can be retrieved within constant expressions even
+         * when the type's member pointers are not known, as long as the compiler can
+         * bit-cast the instance into its reflection tuple, from C++20 onwards.
+         * @tparam N The requested property member index.
+         * @param target The target instance to retrieve member value from.
+         * @return The extracted member value.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto value(const T& target) noexcept
+        -> typename reflection_tuple_t::template element_t<N> {
+          #if defined(__cpp_lib_bit_cast) && defined(__cpp_lib_is_constant_evaluated)
+            if constexpr (!detail::has_member_pointers_v<provider_t>)
+                if (std::is_constant_evaluated())
+                    return std::bit_cast<reflection_tuple_t>(target).template get<N>();
+          #endif
+            return member<N>(target);
+        }
+
+        /**
+         * Views the members of an instance as a contiguous array. This is only available
+         * when all members have the same type and no padding, so that iterating over the
+         * members becomes a plain loop, rather than an unrolled tuple expansion.
+         * @tparam E The common type of the reflected type's members.
+         * @param target The target instance to view the members of.
+         * @return The span over the instance's members.
+         */
+        template <typename E = typename provider_t::homogeneous_t>
+        REFLECTOR_INLINE static auto as_span(T& target) noexcept -> span_t<E>
+        {
+            static_assert(provider_t::is_homogeneous, "the reflected type's members are not homogeneous");
+            return span_t<E>(reinterpret_cast<E*>(&target), provider_t::count);
+        }
+
+        /**
+         * Views the members of a constant instance as a contiguous array.
+         * @tparam E The common type of the reflected type's members.
+         * @param target The target instance to view the members of.
+         * @return The constant span over the instance's members.
+         */
+        template <typename E = typename provider_t::homogeneous_t>
+        REFLECTOR_INLINE static auto as_span(const T& target) noexcept -> span_t<const E>
+        {
+            static_assert(provider_t::is_homogeneous, "the reflected type's members are not homogeneous");
+            return span_t<const E>(reinterpret_cast<const E*>(&target), provider_t::count);
+        }
+
+        /**
+         * Reflects over a raw memory buffer, such as a memory-mapped file or a network
+         * buffer, as if it held an instance of the target type. No instance of the
+         * target type is ever constructed.
+         * @param buffer The buffer to be reflected over.
+         * @return The overlay reflection over the buffer.
+         */
+        REFLECTOR_INLINE static auto over(std::byte *buffer) noexcept -> overlay_t<T>
+        {
+            return overlay_t<T>(buffer);
+        }
+
+        /**
+         * Reflects over a raw constant memory buffer as if it held an instance of the
+         * target type. No instance of the target type is ever constructed.
+         * @param buffer The buffer to be reflected over.
+         * @return The constant overlay reflection over the buffer.
+         */
+        REFLECTOR_INLINE static auto over(const std::byte *buffer) noexcept -> overlay_t<const T>
+        {
+            return overlay_t<const T>(buffer);
         }
 
     private:
+        /**
+         * Locates a property member of an instance by its index.
+         * @tparam N The requested property member index.
+         * @param target The target instance to locate the member within.
+         * @return The located member reference.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto locate(T& target) noexcept
+        -> typename reference_tuple_t::template element_t<N> {
+            if constexpr (detail::has_member_pointers_v<provider_t>) {
+                return provider_t::template access<N>(target);
+            } else {
+                using E = typename reflection_tuple_t::template element_t<N>;
+                constexpr ptrdiff_t shift = offset<N>();
+                return *reinterpret_cast<E*>(reinterpret_cast<uint8_t*>(&target) + shift);
+            }
+        }
+
+        /**
+         * Locates a constant property member of an instance by its index.
+         * @tparam N The requested property member index.
+         * @param target The target instance to locate the member within.
+         * @return The located constant member reference.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto locate(const T& target) noexcept
+        -> const typename reflection_tuple_t::template element_t<N>& {
+            if constexpr (detail::has_member_pointers_v<provider_t>) {
+                return provider_t::template access<N>(target);
+            } else {
+                using E = typename reflection_tuple_t::template element_t<N>;
+                constexpr ptrdiff_t shift = offset<N>();
+                return *reinterpret_cast<const E*>(reinterpret_cast<const uint8_t*>(&target) + shift);
+            }
+        }
+
         /**
          * Retrieves references to the properties of a reflected instance.
          * @tparam I The member types index sequence.
@@ -94,7 +251,7 @@ class reflection_t : public decltype(provider_t<T>::provide())::reference_tuple_
         template <size_t ...I>
         REFLECTOR_INLINE static underlying_t extract(T& target, std::index_sequence<I...>) noexcept
         {
-            return underlying_t(member<I>(target)...);
+            return underlying_t(locate<I>(target)...);
         }
 };
 
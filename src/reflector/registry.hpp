@@ -0,0 +1,291 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The registry of reflected types for batches of heterogeneous records.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/algorithm.hpp>
+#include <reflector/span.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * Registers a list of reflected types, so that batches of records of any of these
+ * types can be visited. Each record in a batch is framed by a tag, which identifies
+ * the type of the record by its index in the registry. Records are visited through
+ * tables of functions built at compile-time, so that no virtual dispatch, nor any
+ * comparison chain on the record tag is ever needed. The described offsets of all
+ * registered types are gathered into a single static arena, from which the members
+ * of visited records are reached, and through which the layout of a record can also
+ * be inspected from its tag alone.
+ * @tparam A The registered types.
+ * @since 1.0
+ */
+template <typename ...A>
+class registry_t
+{
+    static_assert(sizeof...(A) > 0, "registries must have at least one type");
+    static_assert((std::is_trivially_copyable_v<A> && ...), "registered types must be trivially copyable");
+
+    public:
+        typedef uint32_t tag_t;
+
+    public:
+        static constexpr size_t count = sizeof...(A);
+        static constexpr size_t alignment = std::max({alignof(tag_t), alignof(A)...});
+
+    private:
+        /**
+         * Rounds a number of bytes up to the registry's alignment.
+         * @param bytes The number of bytes to be aligned.
+         * @return The aligned number of bytes.
+         */
+        REFLECTOR_CONSTEXPR static size_t align(size_t bytes) noexcept
+        {
+            return (bytes + alignment - 1) / alignment * alignment;
+        }
+
+        /**
+         * Finds the first member of each registered type within the arena.
+         * @return The arena position of each type's first member.
+         */
+        REFLECTOR_CONSTEXPR static auto firsts() noexcept -> std::array<size_t, count + 1>
+        {
+            constexpr std::array<size_t, count> counts = {reflection_t<A>::count...};
+            std::array<size_t, count + 1> result {};
+
+            for (size_t i = 0; i < count; ++i)
+                result[i + 1] = result[i] + counts[i];
+
+            return result;
+        }
+
+    public:
+        /**
+         * The size of a record's tag header, and the size of each registered type's
+         * record frame within a batch. Frames are padded to the registry's alignment
+         * so that the records within an aligned batch are always aligned.
+         * @since 1.0
+         */
+        static constexpr size_t header_size = align(sizeof(tag_t));
+        static constexpr std::array<size_t, count> frame_sizes = {(header_size + align(sizeof(A)))...};
+
+        /**
+         * The position of the first member of each registered type within the arena,
+         * followed by the total number of members of all registered types.
+         * @since 1.0
+         */
+        static constexpr std::array<size_t, count + 1> first_of = firsts();
+
+    private:
+        /**
+         * Appends a table of a registered type's members to the arena.
+         * @tparam M The number of members in the registered type.
+         * @param result The arena being gathered.
+         * @param k The arena position of the type's first member.
+         * @param table The table to be appended.
+         */
+        template <size_t M>
+        REFLECTOR_CONSTEXPR static void append(
+            std::array<size_t, first_of[count]>& result
+          , size_t& k
+          , const std::array<size_t, M>& table
+        ) noexcept {
+            for (size_t j = 0; j < M; ++j)
+                result[k++] = table[j];
+        }
+
+        /**
+         * Gathers a table of all registered types' members into a single arena.
+         * @tparam S The table to be gathered from each type's descriptor.
+         * @return The arena of all registered types' members.
+         */
+        template <const auto& ...S>
+        REFLECTOR_CONSTEXPR static auto gather() noexcept -> std::array<size_t, first_of[count]>
+        {
+            std::array<size_t, first_of[count]> result {};
+            size_t k = 0;
+            ((append(result, k, S)), ...);
+            return result;
+        }
+
+    public:
+        /**
+         * The arena with the offsets of all members of all registered types.
+         * @since 1.0
+         */
+        static constexpr std::array<size_t, first_of[count]> offsets
+            = gather<reflection_t<A>::descriptor_t::offsets...>();
+
+        /**
+         * The tag of a registered type.
+         * @tparam T The registered type to be tagged.
+         * @since 1.0
+         */
+        template <typename T>
+        static constexpr tag_t tag_v = []() {
+            constexpr bool matches[] = {std::is_same_v<T, A>...};
+            static_assert((std::is_same_v<T, A> || ...), "the type is not registered");
+            tag_t tag = 0;
+            while (!matches[tag]) ++tag;
+            return tag;
+        }();
+
+    public:
+        /**
+         * Retrieves the offsets of a registered type's members from the arena.
+         * @param tag The tag of the registered type.
+         * @return The offsets of the type's members.
+         */
+        REFLECTOR_CONSTEXPR static auto fields(tag_t tag) noexcept -> span_t<const size_t>
+        {
+            return span_t<const size_t>(offsets.data() + first_of[tag], first_of[tag + 1] - first_of[tag]);
+        }
+
+        /**
+         * Writes a record of a registered type at the end of a batch. The frame's padding
+         * bytes are zeroed, so that no stale bytes of the batch are ever left within it.
+         * @tparam T The type of the record to be written.
+         * @param buffer The position of the batch where the record must be written.
+         * @param record The record to be written.
+         * @return The batch position just after the written record.
+         */
+        template <typename T>
+        REFLECTOR_INLINE static std::byte *write(std::byte *buffer, const T& record) noexcept
+        {
+            constexpr tag_t tag = tag_v<T>;
+            std::memset(buffer, 0, frame_sizes[tag]);
+            std::memcpy(buffer, &tag, sizeof(tag_t));
+            std::memcpy(buffer + header_size, &record, sizeof(T));
+            return buffer + frame_sizes[tag];
+        }
+
+        /**
+         * Visits a record of a registered type chosen at run-time.
+         * @tparam B The record byte type, possibly const-qualified.
+         * @tparam F The visitor type, which must be invocable with all registered types.
+         * @param tag The tag of the record's type. Must be a valid tag.
+         * @param record The record's first byte.
+         * @param visitor The visitor to invoke with a reference to the record.
+         * @return The visitor's result.
+         */
+        template <typename B, typename F>
+        REFLECTOR_INLINE static decltype(auto) visit(tag_t tag, B *record, F&& visitor)
+        {
+            static_assert(std::is_same_v<std::remove_const_t<B>, std::byte>, "records must be given as bytes");
+            return dispatch_t<B, std::remove_reference_t<F>>::table[tag](record, visitor);
+        }
+
+        /**
+         * Visits each member of a record of a registered type chosen at run-time. The
+         * members are reached through their offsets within the registry's arena.
+         * @tparam B The record byte type, possibly const-qualified.
+         * @tparam F The visitor type, which must be invocable with all members.
+         * @param tag The tag of the record's type. Must be a valid tag.
+         * @param record The record's first byte.
+         * @param visitor The visitor to invoke with a reference to each member.
+         */
+        template <typename B, typename F>
+        REFLECTOR_INLINE static void visit_fields(tag_t tag, B *record, F&& visitor)
+        {
+            visit(tag, record, [record, &visitor](auto& target) {
+                using T = std::remove_const_t<std::remove_reference_t<decltype(target)>>;
+                visit_fields<T>(record, visitor, std::make_index_sequence<reflection_t<T>::count>());
+            });
+        }
+
+        /**
+         * Visits all records within a batch. The walk stops at the first record with an
+         * invalid tag, or whose frame does not fit within the batch.
+         * @tparam B The batch byte type, possibly const-qualified.
+         * @tparam F The visitor type, which must be invocable with all registered types.
+         * @param first The batch's first byte.
+         * @param last The byte just after the batch's end.
+         * @param visitor The visitor to invoke with a reference to each record.
+         * @return The position just after the last visited record.
+         */
+        template <typename B, typename F>
+        REFLECTOR_INLINE static B *for_each(B *first, B *last, F&& visitor)
+        {
+            tag_t tag;
+
+            while (static_cast<size_t>(last - first) >= header_size) {
+                std::memcpy(&tag, first, sizeof(tag_t));
+
+                if (tag >= count || static_cast<size_t>(last - first) < frame_sizes[tag])
+                    break;
+
+                visit(tag, first + header_size, visitor);
+                first += frame_sizes[tag];
+            }
+
+            return first;
+        }
+
+    private:
+        /**
+         * Builds the table of functions dispatching a visitor to each registered type.
+         * @tparam B The record byte type, possibly const-qualified.
+         * @tparam F The visitor type.
+         * @since 1.0
+         */
+        template <typename B, typename F>
+        struct dispatch_t
+        {
+            using first_t = typename supertuple::tuple_t<A...>::template element_t<0>;
+            using result_t = std::invoke_result_t<F&, detail::copy_const_t<B, first_t>&>;
+
+            static_assert(
+                (std::is_same_v<result_t, std::invoke_result_t<F&, detail::copy_const_t<B, A>&>> && ...)
+              , "the visitor must return the same type for all registered types"
+            );
+
+            /**
+             * Invokes the visitor with a reference to a record.
+             * @tparam T The type of the record to be visited.
+             * @param record The record's first byte.
+             * @param visitor The visitor to invoke with the record.
+             * @return The visitor's result.
+             */
+            template <typename T>
+            REFLECTOR_INLINE static result_t invoke(B *record, F& visitor)
+            {
+                return visitor(*reinterpret_cast<detail::copy_const_t<B, T>*>(record));
+            }
+
+            static constexpr result_t (*table[])(B*, F&) = {&invoke<A>...};
+        };
+
+        /**
+         * Visits each member of a record, found at the record's offsets in the arena.
+         * @tparam T The type of the record to be visited.
+         * @tparam B The record byte type, possibly const-qualified.
+         * @tparam F The visitor type.
+         * @tparam I The members index sequence.
+         * @param record The record's first byte.
+         * @param visitor The visitor to invoke with a reference to each member.
+         */
+        template <typename T, typename B, typename F, size_t ...I>
+        REFLECTOR_INLINE static void visit_fields(B *record, F& visitor, std::index_sequence<I...>)
+        {
+            using reflection_tuple_t = typename reflection_t<T>::reflection_tuple_t;
+            constexpr size_t first = first_of[tag_v<T>];
+
+            (visitor(*reinterpret_cast<detail::copy_const_t<B, typename reflection_tuple_t::template element_t<I>>*>(
+                record + offsets[first + I])), ...);
+        }
+};
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,198 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The sequence lock for snapshots of reflected instances.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/atomic.hpp>
+#include <reflector/flat.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Checks whether a type can be accessed as a whole block of machine words. That
+     * is, when the type has no padding and is aligned to, and a multiple of, a word.
+     * @tparam T The reflected type to be checked.
+     * @since 1.0
+     */
+    template <typename T>
+    inline constexpr bool wordwise_v =
+        !reflection_t<T>::descriptor_t::has_padding
+        && alignof(T) >= alignof(uintptr_t)
+        && sizeof(T) % sizeof(uintptr_t) == 0;
+}
+
+/**
+ * Protects a shared instance of a reflected type with a sequence lock, for a single
+ * writer and many readers. Readers never block the writer, nor each other: they take
+ * a snapshot of the instance and retry whenever a write overlaps with the snapshot.
+ * All accesses to the protected instance are atomic, so that overlapping reads and
+ * writes are not data races. Snapshots are taken leaf by leaf through reflection, thus
+ * also descending into nested aggregate members, or word by word, when the type has
+ * no padding and is a whole number of words.
+ * @tparam T The reflected type to be protected.
+ * @since 1.0
+ */
+template <typename T>
+class seqlock_t
+{
+    static_assert(std::is_trivially_copyable_v<T>, "sequence-locked types must be trivially copyable");
+
+    public:
+        typedef T target_t;
+
+    private:
+        template <size_t N>
+        using leaf_t = typename flat_reflection_t<T>::reflection_tuple_t::template element_t<N>;
+
+    private:
+        alignas(REFLECTOR_CACHE_LINE_SIZE) std::atomic<uint64_t> m_sequence {0};
+        mutable T m_value {};
+
+    public:
+        REFLECTOR_INLINE seqlock_t() noexcept = default;
+        REFLECTOR_INLINE seqlock_t(const seqlock_t&) = delete;
+        REFLECTOR_INLINE seqlock_t(seqlock_t&&) = delete;
+
+        /**
+         * Initializes the protected instance.
+         * @param value The instance's initial value.
+         */
+        REFLECTOR_INLINE explicit seqlock_t(const T& value) noexcept
+          : m_value (value)
+        {}
+
+        REFLECTOR_INLINE seqlock_t& operator=(const seqlock_t&) = delete;
+        REFLECTOR_INLINE seqlock_t& operator=(seqlock_t&&) = delete;
+
+        /**
+         * Takes a consistent snapshot of the protected instance. The snapshot is retried
+         * until no write has overlapped with it.
+         * @return The snapshot of the protected instance.
+         */
+        REFLECTOR_INLINE T load() const noexcept
+        {
+            T result;
+            while (!try_load(result));
+            return result;
+        }
+
+        /**
+         * Tries to take a consistent snapshot of the protected instance. This fails if a
+         * write is in progress or overlaps with the snapshot.
+         * @param result The instance to take the snapshot into.
+         * @return Has the snapshot been consistently taken?
+         */
+        REFLECTOR_INLINE bool try_load(T& result) const noexcept
+        {
+            const uint64_t before = m_sequence.load(std::memory_order_acquire);
+
+            if (before & 1)
+                return false;
+
+            read(result);
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            return m_sequence.load(std::memory_order_relaxed) == before;
+        }
+
+        /**
+         * Replaces the protected instance. Must only be called by the single writer.
+         * @param value The new instance's value.
+         */
+        REFLECTOR_INLINE void store(const T& value) noexcept
+        {
+            const uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+
+            m_sequence.store(sequence + 1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+
+            write(value);
+            m_sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+        /**
+         * Informs the number of writes completed to the protected instance so far.
+         * @return The number of completed writes.
+         */
+        REFLECTOR_INLINE uint64_t version() const noexcept
+        {
+            return m_sequence.load(std::memory_order_acquire) >> 1;
+        }
+
+    private:
+        /**
+         * Copies the protected instance with relaxed atomic loads.
+         * @param result The instance to copy into.
+         */
+        REFLECTOR_INLINE void read(T& result) const noexcept
+        {
+            if constexpr (detail::wordwise_v<T>) {
+                using word_t = detail::atomic_member_t<uintptr_t>;
+                auto source = reinterpret_cast<uintptr_t*>(&m_value);
+                auto target = reinterpret_cast<uintptr_t*>(&result);
+                for (size_t i = 0; i < sizeof(T) / sizeof(uintptr_t); ++i)
+                    target[i] = word_t::load(source[i], std::memory_order_relaxed);
+            } else {
+                read(result, std::make_index_sequence<flat_reflection_t<T>::descriptor_t::count>());
+            }
+        }
+
+        /**
+         * Copies into the protected instance with relaxed atomic stores.
+         * @param value The instance to copy from.
+         */
+        REFLECTOR_INLINE void write(const T& value) noexcept
+        {
+            if constexpr (detail::wordwise_v<T>) {
+                using word_t = detail::atomic_member_t<uintptr_t>;
+                auto source = reinterpret_cast<const uintptr_t*>(&value);
+                auto target = reinterpret_cast<uintptr_t*>(&m_value);
+                for (size_t i = 0; i < sizeof(T) / sizeof(uintptr_t); ++i)
+                    word_t::store(target[i], source[i], std::memory_order_relaxed);
+            } else {
+                write(value, std::make_index_sequence<flat_reflection_t<T>::descriptor_t::count>());
+            }
+        }
+
+        /**
+         * Copies each leaf of the protected instance with a relaxed atomic load.
+         * @tparam I The leaf members index sequence.
+         * @param result The instance to copy into.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE void read(T& result, std::index_sequence<I...>) const noexcept
+        {
+            using flat_t = flat_reflection_t<T>;
+            ((flat_t::template member<I>(result) = detail::atomic_member_t<leaf_t<I>>::load(
+                flat_t::template member<I>(m_value), std::memory_order_relaxed)), ...);
+        }
+
+        /**
+         * Copies into each leaf of the protected instance with a relaxed atomic store.
+         * @tparam I The leaf members index sequence.
+         * @param value The instance to copy from.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE void write(const T& value, std::index_sequence<I...>) noexcept
+        {
+            using flat_t = flat_reflection_t<T>;
+            (detail::atomic_member_t<leaf_t<I>>::store(
+                flat_t::template member<I>(m_value), flat_t::template member<I>(value)
+              , std::memory_order_relaxed), ...);
+        }
+};
+
+REFLECTOR_END_NAMESPACE
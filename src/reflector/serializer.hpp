@@ -0,0 +1,117 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The binary serializer for reflected types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+
+#include <reflector/environment.h>
+#include <reflector/flat.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Copies the contiguous runs of members of an instance into a packed buffer.
+     * @tparam T The reflected type to be serialized.
+     * @tparam I The contiguous runs index sequence.
+     * @param source The instance's first byte.
+     * @param buffer The buffer to serialize the instance into.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE void serialize(
+        const std::byte *source
+      , std::byte *buffer
+      , std::index_sequence<I...>
+    ) noexcept {
+        using descriptor_t = typename flat_reflection_t<T>::descriptor_t;
+        constexpr auto& runs = descriptor_t::runs;
+        (std::memcpy(buffer + runs[I].position, source + runs[I].offset, runs[I].length), ...);
+    }
+
+    /**
+     * Copies the contiguous runs of members of an instance from a packed buffer.
+     * @tparam T The reflected type to be deserialized.
+     * @tparam I The contiguous runs index sequence.
+     * @param buffer The buffer to deserialize the instance from.
+     * @param target The instance's first byte.
+     */
+    template <typename T, size_t ...I>
+    REFLECTOR_INLINE void deserialize(
+        const std::byte *buffer
+      , std::byte *target
+      , std::index_sequence<I...>
+    ) noexcept {
+        using descriptor_t = typename flat_reflection_t<T>::descriptor_t;
+        constexpr auto& runs = descriptor_t::runs;
+        (std::memcpy(target + runs[I].offset, buffer + runs[I].position, runs[I].length), ...);
+    }
+}
+
+/**
+ * Informs the number of bytes a reflected type's instance occupies when serialized.
+ * As padding bytes are not serialized, not even those within nested aggregate
+ * members, this may be smaller than the type's size.
+ * @tparam T The reflected type to be serialized.
+ * @since 1.0
+ */
+template <typename T>
+inline constexpr size_t serialized_size_v = flat_reflection_t<T>::descriptor_t::packed_size;
+
+/**
+ * Serializes an instance of a reflected type into a buffer. The instance's members
+ * are written in declaration order, without any padding bytes amongst them. Adjacent
+ * members which are not separated by padding are copied at once, so that a type with
+ * no padding at all is serialized with a single copy.
+ * @tparam T The reflected type to be serialized.
+ * @param source The instance to be serialized.
+ * @param buffer The buffer to serialize the instance into.
+ * @return The buffer position just after the serialized instance.
+ */
+template <typename T>
+REFLECTOR_INLINE std::byte *serialize(const T& source, std::byte *buffer) noexcept
+{
+    using descriptor_t = typename flat_reflection_t<T>::descriptor_t;
+
+    if constexpr (!descriptor_t::has_padding) {
+        std::memcpy(buffer, &source, sizeof(T));
+    } else {
+        detail::serialize<T>(
+            reinterpret_cast<const std::byte*>(&source), buffer
+          , std::make_index_sequence<descriptor_t::runs.size()>());
+    }
+
+    return buffer + serialized_size_v<T>;
+}
+
+/**
+ * Deserializes an instance of a reflected type from a buffer. The padding bytes of
+ * the target instance, if any, are left untouched.
+ * @tparam T The reflected type to be deserialized.
+ * @param buffer The buffer to deserialize the instance from.
+ * @param target The instance to be deserialized into.
+ * @return The buffer position just after the deserialized instance.
+ */
+template <typename T>
+REFLECTOR_INLINE const std::byte *deserialize(const std::byte *buffer, T& target) noexcept
+{
+    using descriptor_t = typename flat_reflection_t<T>::descriptor_t;
+
+    if constexpr (!descriptor_t::has_padding) {
+        std::memcpy(&target, buffer, sizeof(T));
+    } else {
+        detail::deserialize<T>(
+            buffer, reinterpret_cast<std::byte*>(&target)
+          , std::make_index_sequence<descriptor_t::runs.size()>());
+    }
+
+    return buffer + serialized_size_v<T>;
+}
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,323 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The struct-of-arrays container for reflected types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/detail/tuple.hpp>
+#include <reflector/reflector.hpp>
+#include <reflector/span.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Stores a boolean member in a struct-of-arrays column. As the standard vector of
+     * booleans is a bitset, its elements are neither contiguous nor referenceable, so
+     * boolean columns store this byte-sized wrapper instead. Therefore, views over a
+     * boolean column are views over these wrappers, rather than over booleans.
+     * @since 1.0
+     */
+    struct boolean_t
+    {
+        bool value = false;
+
+        REFLECTOR_CONSTEXPR boolean_t() noexcept = default;
+        REFLECTOR_CONSTEXPR boolean_t(bool value) noexcept : value (value) {}
+
+        /**
+         * Retrieves the wrapped boolean value.
+         * @return The wrapped value.
+         */
+        REFLECTOR_CONSTEXPR operator bool() const noexcept
+        {
+            return value;
+        }
+    };
+
+    static_assert(sizeof(boolean_t) == sizeof(bool) && alignof(boolean_t) == alignof(bool));
+
+    /**
+     * The type of the elements actually stored in a struct-of-arrays column.
+     * @tparam R The member type to be stored.
+     * @since 1.0
+     */
+    template <typename R>
+    using stored_t = std::conditional_t<std::is_same_v<R, bool>, boolean_t, R>;
+
+    /**
+     * Retrieves a reference to a member stored in a struct-of-arrays column.
+     * @tparam R The member type stored in the column.
+     * @param element The column's stored element.
+     * @return The member reference.
+     */
+    template <typename R>
+    REFLECTOR_INLINE R& unwrap(stored_t<R>& element) noexcept
+    {
+        if constexpr (std::is_same_v<R, bool>) return element.value;
+        else return element;
+    }
+
+    template <typename R>
+    REFLECTOR_INLINE const R& unwrap(const stored_t<R>& element) noexcept
+    {
+        if constexpr (std::is_same_v<R, bool>) return element.value;
+        else return element;
+    }
+
+    /**
+     * Produces the storage types for a struct-of-arrays layout of a reflected type.
+     * @tparam T The type to be stored in a struct-of-arrays layout.
+     * @since 1.0
+     */
+    template <typename T, typename = typename reflection_t<T>::reflection_tuple_t>
+    struct soa_storage_t;
+
+    /**
+     * Produces the storage types for a struct-of-arrays layout of a reflected type,
+     * so that each property member of the reflected type is stored in its own column.
+     * @tparam T The type to be stored in a struct-of-arrays layout.
+     * @tparam R The internal property types of the reflected type.
+     * @since 1.0
+     */
+    template <typename T, typename ...R>
+    struct soa_storage_t<T, supertuple::tuple_t<R...>>
+    {
+        using column_tuple_t = supertuple::tuple_t<std::vector<stored_t<R>>...>;
+        using reference_tuple_t = supertuple::tuple_t<R&...>;
+        using const_reference_tuple_t = supertuple::tuple_t<const R&...>;
+    };
+}
+
+/**
+ * Stores instances of a reflected type in a struct-of-arrays layout. Each property
+ * member of the reflected type is kept in its own contiguous column, so that scans
+ * over a few members of many instances do not waste memory bandwidth loading the
+ * members that are not needed.
+ * @tparam T The reflected type to be stored.
+ * @since 1.0
+ */
+template <typename T>
+class soa_vector_t
+{
+    public:
+        typedef T target_t;
+
+    private:
+        typedef reflection_t<T> underlying_t;
+        typedef detail::soa_storage_t<T> storage_t;
+
+    public:
+        using reflection_tuple_t = typename underlying_t::reflection_tuple_t;
+        using reference_tuple_t = typename storage_t::reference_tuple_t;
+        using const_reference_tuple_t = typename storage_t::const_reference_tuple_t;
+
+        /**
+         * The type of the member stored in one of the container's columns.
+         * @tparam N The index of the requested column.
+         * @since 1.0
+         */
+        template <size_t N>
+        using element_t = typename reflection_tuple_t::template element_t<N>;
+
+        /**
+         * The type of the elements actually stored in one of the container's columns.
+         * These are the members themselves, except for boolean members.
+         * @tparam N The index of the requested column.
+         * @since 1.0
+         */
+        template <size_t N>
+        using column_element_t = detail::stored_t<element_t<N>>;
+
+    public:
+        static constexpr size_t count = reflection_tuple_t::count;
+
+    static_assert(count > 0, "struct-of-arrays of types without members are not supported");
+
+    private:
+        typename storage_t::column_tuple_t m_columns;
+
+    public:
+        REFLECTOR_INLINE soa_vector_t() = default;
+        REFLECTOR_INLINE soa_vector_t(const soa_vector_t&) = default;
+        REFLECTOR_INLINE soa_vector_t(soa_vector_t&&) = default;
+
+        REFLECTOR_INLINE soa_vector_t& operator=(const soa_vector_t&) = default;
+        REFLECTOR_INLINE soa_vector_t& operator=(soa_vector_t&&) = default;
+
+        /**
+         * Retrieves references to the members of an instance stored in the container.
+         * @param index The index of the requested instance.
+         * @return The tuple of references to the instance's members.
+         */
+        REFLECTOR_INLINE reference_tuple_t operator[](size_t index) noexcept
+        {
+            return reference(index, std::make_index_sequence<count>());
+        }
+
+        /**
+         * Retrieves references to the members of a constant instance in the container.
+         * @param index The index of the requested instance.
+         * @return The tuple of constant references to the instance's members.
+         */
+        REFLECTOR_INLINE const_reference_tuple_t operator[](size_t index) const noexcept
+        {
+            return reference(index, std::make_index_sequence<count>());
+        }
+
+        /**
+         * Appends a new instance to the end of the container. Room for the instance
+         * is reserved in all columns beforehand, so that no column is left longer than
+         * the others if any of them fails to grow.
+         * @param value The instance to be transposed into the container's columns.
+         */
+        REFLECTOR_INLINE void push_back(const T& value)
+        {
+            const size_t size = this->size() + 1;
+
+            apply([size](auto& column) {
+                if (column.capacity() < size)
+                    column.reserve(size > 2 * column.capacity() ? size : 2 * column.capacity());
+            });
+
+            push_back(value, std::make_index_sequence<count>());
+        }
+
+        /**
+         * Retrieves a view over all values of a member within the container.
+         * @tparam N The index of the requested member column.
+         * @return The member column view.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE auto column() noexcept -> span_t<column_element_t<N>>
+        {
+            auto& column = m_columns.template get<N>();
+            return span_t(column.data(), column.size());
+        }
+
+        /**
+         * Retrieves a constant view over all values of a member within the container.
+         * @tparam N The index of the requested member column.
+         * @return The constant member column view.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE auto column() const noexcept -> span_t<const column_element_t<N>>
+        {
+            const auto& column = m_columns.template get<N>();
+            return span_t(column.data(), column.size());
+        }
+
+        /**
+         * Reserves memory for a number of instances in each of the container's columns.
+         * @param capacity The number of instances to reserve memory for.
+         */
+        REFLECTOR_INLINE void reserve(size_t capacity)
+        {
+            apply([capacity](auto& column) { column.reserve(capacity); });
+        }
+
+        /**
+         * Resizes the container to the given number of instances.
+         * @param size The new number of instances in the container.
+         */
+        REFLECTOR_INLINE void resize(size_t size)
+        {
+            apply([size](auto& column) { column.resize(size); });
+        }
+
+        /**
+         * Removes all instances from the container.
+         */
+        REFLECTOR_INLINE void clear() noexcept
+        {
+            apply([](auto& column) { column.clear(); });
+        }
+
+        /**
+         * Informs the number of instances currently stored in the container.
+         * @return The number of instances in the container.
+         */
+        REFLECTOR_INLINE size_t size() const noexcept
+        {
+            return m_columns.template get<0>().size();
+        }
+
+        /**
+         * Informs whether the container is empty.
+         * @return Is the container empty?
+         */
+        REFLECTOR_INLINE bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+    private:
+        /**
+         * Applies a function to each one of the container's columns.
+         * @tparam F The type of function to be applied.
+         * @param lambda The function to apply to each column.
+         */
+        template <typename F>
+        REFLECTOR_INLINE void apply(F&& lambda)
+        {
+            apply(std::forward<F>(lambda), std::make_index_sequence<count>());
+        }
+
+        /**
+         * Applies a function to each one of the container's columns.
+         * @tparam F The type of function to be applied.
+         * @tparam I The column indeces sequence.
+         * @param lambda The function to apply to each column.
+         */
+        template <typename F, size_t ...I>
+        REFLECTOR_INLINE void apply(F&& lambda, std::index_sequence<I...>)
+        {
+            (lambda(m_columns.template get<I>()), ...);
+        }
+
+        /**
+         * Transposes an instance into the container's columns.
+         * @tparam I The column indeces sequence.
+         * @param value The instance to be transposed.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE void push_back(const T& value, std::index_sequence<I...>)
+        {
+            (m_columns.template get<I>().push_back(underlying_t::template member<I>(value)), ...);
+        }
+
+        /**
+         * Gathers references to an instance's members from the container's columns.
+         * @tparam I The column indeces sequence.
+         * @param index The index of the requested instance.
+         * @return The tuple of references to the instance's members.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE reference_tuple_t reference(size_t index, std::index_sequence<I...>) noexcept
+        {
+            return reference_tuple_t(detail::unwrap<element_t<I>>(m_columns.template get<I>()[index])...);
+        }
+
+        /**
+         * Gathers constant references to an instance's members from the columns.
+         * @tparam I The column indeces sequence.
+         * @param index The index of the requested instance.
+         * @return The tuple of constant references to the instance's members.
+         */
+        template <size_t ...I>
+        REFLECTOR_INLINE const_reference_tuple_t reference(size_t index, std::index_sequence<I...>) const noexcept
+        {
+            return const_reference_tuple_t(detail::unwrap<element_t<I>>(m_columns.template get<I>()[index])...);
+        }
+};
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,229 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Sort key extraction and radix sorting of reflected types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/span.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * The smallest unsigned integer type with at least the given number of bytes.
+     * @tparam B The minimum number of bytes of the requested type.
+     * @since 1.0
+     */
+    template <size_t B>
+    using unsigned_t =
+        std::conditional_t<(B <= 1), uint8_t,
+        std::conditional_t<(B <= 2), uint16_t,
+        std::conditional_t<(B <= 4), uint32_t, uint64_t>>>;
+
+    /**
+     * Transforms a value into an unsigned integer with the same bit width, so that
+     * comparing the produced unsigned integers preserves the order of the values.
+     * Signed integers have their sign bit flipped, while floating-point numbers also
+     * have all their other bits flipped when negative.
+     * @tparam E The type of the value to be transformed.
+     * @param value The value to be transformed.
+     * @return The order-preserving unsigned integer.
+     */
+    template <typename E>
+    REFLECTOR_INLINE auto ordered(E value) noexcept -> unsigned_t<sizeof(E)>
+    {
+        using U = unsigned_t<sizeof(E)>;
+        constexpr U sign = U(1) << (sizeof(E) * 8 - 1);
+
+        if constexpr (std::is_enum_v<E>) {
+            return ordered(static_cast<std::underlying_type_t<E>>(value));
+        } else if constexpr (std::is_floating_point_v<E>) {
+            static_assert(sizeof(E) == sizeof(U), "unsupported floating-point type");
+            U bits;
+            std::memcpy(&bits, &value, sizeof(E));
+            return (bits & sign) ? U(~bits) : U(bits | sign);
+        } else if constexpr (std::is_signed_v<E>) {
+            return static_cast<U>(static_cast<U>(value) ^ sign);
+        } else {
+            static_assert(std::is_integral_v<E>, "the member type cannot be part of a sort key");
+            return static_cast<U>(value);
+        }
+    }
+}
+
+/**
+ * Extracts a fixed-width unsigned key from the selected members of a reflected type.
+ * The members are packed in the given order, from the most to the least significant
+ * bits of the key, so that comparing keys is equivalent to comparing the instances'
+ * selected members lexicographically.
+ * @tparam T The reflected type to extract keys from.
+ * @tparam I The indeces of the members that compose the key, by priority.
+ * @since 1.0
+ */
+template <typename T, size_t ...I>
+struct sort_key_t
+{
+    static_assert(sizeof...(I) > 0, "sort keys must have at least one member");
+
+    private:
+        typedef reflection_t<T> underlying_t;
+
+        template <size_t N>
+        using element_t = typename underlying_t::reflection_tuple_t::template element_t<N>;
+
+    public:
+        static constexpr size_t width = (size_t(0) + ... + sizeof(element_t<I>));
+
+    static_assert(width <= sizeof(uint64_t), "sort keys must fit within 64 bits");
+
+    public:
+        typedef detail::unsigned_t<width> key_t;
+
+        /**
+         * Extracts the sort key of an instance.
+         * @param value The instance to extract the key from.
+         * @return The instance's sort key.
+         */
+        REFLECTOR_INLINE key_t operator()(const T& value) const noexcept
+        {
+            key_t key = 0;
+            ((key = static_cast<key_t>(shift<element_t<I>>(key)
+                | detail::ordered(underlying_t::template member<I>(value)))), ...);
+            return key;
+        }
+
+        /**
+         * Compares two instances by their sort keys.
+         * @param a The first instance to be compared.
+         * @param b The second instance to be compared.
+         * @return Is the first instance ordered before the second?
+         */
+        REFLECTOR_INLINE bool compare(const T& a, const T& b) const noexcept
+        {
+            return (*this)(a) < (*this)(b);
+        }
+
+    private:
+        /**
+         * Shifts a partial key to make room for the bits of the next member.
+         * @tparam E The type of the next member.
+         * @param key The partial key to be shifted.
+         * @return The shifted key.
+         */
+        template <typename E>
+        REFLECTOR_CONSTEXPR static key_t shift(key_t key) noexcept
+        {
+            if constexpr (sizeof(E) >= sizeof(key_t)) return 0;
+            else return static_cast<key_t>(key << (sizeof(E) * 8));
+        }
+};
+
+namespace detail
+{
+    /**
+     * Distributes the indeces of instances by one byte of their keys. The pass sorts
+     * stably by the given byte, and is skipped if all keys share the same byte.
+     * @tparam K The key type.
+     * @param keys The keys to be distributed.
+     * @param indeces The instance indeces to be distributed.
+     * @param kscratch The buffer to distribute keys into.
+     * @param iscratch The buffer to distribute indeces into.
+     * @param byte The byte of the keys to distribute by.
+     * @return Have the keys and indeces been distributed?
+     */
+    template <typename K>
+    REFLECTOR_INLINE bool radix_pass(
+        const std::vector<K>& keys
+      , const std::vector<size_t>& indeces
+      , std::vector<K>& kscratch
+      , std::vector<size_t>& iscratch
+      , size_t byte
+    ) noexcept {
+        std::array<size_t, 256> counts {};
+        const size_t shift = byte * 8;
+
+        for (K key : keys)
+            ++counts[(key >> shift) & 0xff];
+
+        if (counts[(keys.front() >> shift) & 0xff] == keys.size())
+            return false;
+
+        for (size_t i = 0, total = 0; i < 256; ++i)
+            total += std::exchange(counts[i], total);
+
+        for (size_t i = 0; i < keys.size(); ++i) {
+            const size_t target = counts[(keys[i] >> shift) & 0xff]++;
+            kscratch[target] = keys[i];
+            iscratch[target] = indeces[i];
+        }
+
+        return true;
+    }
+}
+
+/**
+ * Sorts a batch of reflected instances by their keys, with a stable least-significant
+ * digit radix sort. The keys are extracted only once, and sorted together with the
+ * instances' original indeces. The instances are then permuted in place by following
+ * the cycles of the sorted indeces, so that each instance is moved directly into its
+ * final position. Passes over key bytes shared by all instances are skipped.
+ * @tparam T The reflected type of the batch's instances.
+ * @tparam K The key extractor type, such as a sort key.
+ * @param batch The batch of instances to be sorted in place.
+ * @param extractor The key extractor.
+ */
+template <typename T, typename K>
+REFLECTOR_INLINE void radix_sort(span_t<T> batch, K extractor)
+{
+    using key_t = typename K::key_t;
+    static_assert(std::is_unsigned_v<key_t>, "radix sort keys must be unsigned integers");
+
+    if (batch.size() < 2)
+        return;
+
+    std::vector<key_t> keys (batch.size()), kscratch (batch.size());
+    std::vector<size_t> indeces (batch.size()), iscratch (batch.size());
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        keys[i] = extractor(batch[i]);
+        indeces[i] = i;
+    }
+
+    for (size_t byte = 0; byte < sizeof(key_t); ++byte) {
+        if (detail::radix_pass(keys, indeces, kscratch, iscratch, byte)) {
+            keys.swap(kscratch);
+            indeces.swap(iscratch);
+        }
+    }
+
+    for (size_t i = 0; i < batch.size(); ++i) {
+        if (indeces[i] == i)
+            continue;
+
+        T value = std::move(batch[i]);
+        size_t j = i;
+
+        for (size_t k = indeces[j]; k != i; j = k, k = indeces[j]) {
+            batch[j] = std::move(batch[k]);
+            indeces[j] = j;
+        }
+
+        batch[j] = std::move(value);
+        indeces[j] = j;
+    }
+}
+
+REFLECTOR_END_NAMESPACE
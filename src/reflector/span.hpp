@@ -0,0 +1,129 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file A non-owning view over a contiguous sequence of objects.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * A non-owning view over a contiguous sequence of objects. As the library targets
+ * C++17, this type stands in for the standard span, which is only available from
+ * C++20 onwards, and provides only the small subset of its interface that we need.
+ * @tparam T The type of the elements in the viewed sequence.
+ * @since 1.0
+ */
+template <typename T>
+class span_t
+{
+    public:
+        typedef T element_t;
+
+    private:
+        T *m_data = nullptr;
+        size_t m_size = 0;
+
+    public:
+        REFLECTOR_CONSTEXPR span_t() noexcept = default;
+        REFLECTOR_CONSTEXPR span_t(const span_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR span_t(span_t&&) noexcept = default;
+
+        /**
+         * Creates a new view over a contiguous sequence of objects.
+         * @param data The pointer to the first element of the sequence.
+         * @param size The number of elements in the sequence.
+         */
+        REFLECTOR_CONSTEXPR span_t(T *data, size_t size) noexcept
+          : m_data (data)
+          , m_size (size)
+        {}
+
+        /**
+         * Creates a new view over a fixed-size array.
+         * @tparam N The number of elements in the array.
+         * @param array The array to be viewed.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR span_t(T (&array)[N]) noexcept
+          : span_t (array, N)
+        {}
+
+        /**
+         * Creates a new view over a contiguous container, such as vectors or arrays.
+         * @tparam C The container type to be viewed.
+         * @param container The container to be viewed.
+         */
+        template <
+            typename C
+          , typename = std::enable_if_t<
+                !std::is_same_v<std::remove_cv_t<C>, span_t> &&
+                std::is_convertible_v<decltype(std::declval<C&>().data()), T*>>>
+        REFLECTOR_CONSTEXPR span_t(C& container) noexcept
+          : span_t (container.data(), container.size())
+        {}
+
+        /**
+         * Converts a view over mutable elements into a view over constant ones.
+         * @tparam U The original view's element type.
+         * @param other The view to be converted.
+         */
+        template <
+            typename U
+          , typename = std::enable_if_t<
+                !std::is_same_v<U, T> &&
+                std::is_convertible_v<U(*)[], T(*)[]>>>
+        REFLECTOR_CONSTEXPR span_t(const span_t<U>& other) noexcept
+          : span_t (other.data(), other.size())
+        {}
+
+        REFLECTOR_CONSTEXPR span_t& operator=(const span_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR span_t& operator=(span_t&&) noexcept = default;
+
+        /**
+         * Accesses an element of the viewed sequence by its index.
+         * @param index The index of the requested element.
+         * @return The requested element reference.
+         */
+        REFLECTOR_CONSTEXPR T& operator[](size_t index) const noexcept
+        {
+            return m_data[index];
+        }
+
+        /**
+         * Retrieves a view over a subsequence of the currently viewed sequence.
+         * @param offset The index of the first element of the subsequence.
+         * @param count The number of elements in the subsequence.
+         * @return The subsequence view.
+         */
+        REFLECTOR_CONSTEXPR span_t subspan(size_t offset, size_t count) const noexcept
+        {
+            return span_t(m_data + offset, count);
+        }
+
+        REFLECTOR_CONSTEXPR T *data() const noexcept { return m_data; }
+        REFLECTOR_CONSTEXPR T *begin() const noexcept { return m_data; }
+        REFLECTOR_CONSTEXPR T *end() const noexcept { return m_data + m_size; }
+
+        REFLECTOR_CONSTEXPR size_t size() const noexcept { return m_size; }
+        REFLECTOR_CONSTEXPR bool empty() const noexcept { return m_size == 0; }
+};
+
+/*
+ * Deduction guides for creating views from arrays and contiguous containers.
+ * @since 1.0
+ */
+template <typename T, size_t N>
+span_t(T (&)[N]) -> span_t<T>;
+
+template <typename C>
+span_t(C&) -> span_t<std::remove_pointer_t<decltype(std::declval<C&>().data())>>;
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,488 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Batched streaming of fixed-layout records over POSIX file descriptors.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <utility>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+#include <reflector/span.hpp>
+#include <reflector/view.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * The strategies with which records can be read from a file descriptor. Buffered
+ * streams read each batch into a private buffer, prefetched streams additionally ask
+ * the kernel to fetch the following batch while the current one is being processed,
+ * and mapped streams map each batch directly from the file into memory.
+ * @since 1.0
+ */
+enum class stream_mode_t : uint8_t
+{
+    buffered
+  , prefetched
+  , mapped
+};
+
+/**
+ * A batch of records read from a stream. Records are not copied out of the stream's
+ * buffer, but handed out as overlay reflections into it instead. A batch remains valid
+ * only until the next batch is read from the same stream.
+ * @tparam T The type of records within the batch.
+ * @since 1.0
+ */
+template <typename T>
+class record_batch_t
+{
+    public:
+        typedef T target_t;
+        typedef overlay_t<const T> record_t;
+
+    public:
+        /**
+         * Iterates over the records of a batch, yielding an overlay to each of them.
+         * @since 1.0
+         */
+        class iterator_t
+        {
+            private:
+                const std::byte *m_cursor;
+
+            public:
+                REFLECTOR_CONSTEXPR explicit iterator_t(const std::byte *cursor) noexcept
+                  : m_cursor (cursor)
+                {}
+
+                REFLECTOR_CONSTEXPR record_t operator*() const noexcept
+                {
+                    return record_t(m_cursor);
+                }
+
+                REFLECTOR_CONSTEXPR iterator_t& operator++() noexcept
+                {
+                    m_cursor += sizeof(T);
+                    return *this;
+                }
+
+                REFLECTOR_CONSTEXPR bool operator==(const iterator_t& other) const noexcept
+                {
+                    return m_cursor == other.m_cursor;
+                }
+
+                REFLECTOR_CONSTEXPR bool operator!=(const iterator_t& other) const noexcept
+                {
+                    return m_cursor != other.m_cursor;
+                }
+        };
+
+    private:
+        const std::byte *m_buffer = nullptr;
+        size_t m_size = 0;
+
+    public:
+        REFLECTOR_CONSTEXPR record_batch_t() noexcept = default;
+        REFLECTOR_CONSTEXPR record_batch_t(const record_batch_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR record_batch_t(record_batch_t&&) noexcept = default;
+
+        /**
+         * Wraps a buffer of contiguous records into a batch.
+         * @param buffer The buffer holding the batch's records.
+         * @param size The number of records within the buffer.
+         */
+        REFLECTOR_CONSTEXPR record_batch_t(const std::byte *buffer, size_t size) noexcept
+          : m_buffer (buffer)
+          , m_size (size)
+        {}
+
+        REFLECTOR_CONSTEXPR record_batch_t& operator=(const record_batch_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR record_batch_t& operator=(record_batch_t&&) noexcept = default;
+
+        /**
+         * Overlays a record of the batch by its index.
+         * @param index The index of the requested record.
+         * @return The overlay reflection of the record.
+         */
+        REFLECTOR_CONSTEXPR record_t operator[](size_t index) const noexcept
+        {
+            return record_t(m_buffer + index * sizeof(T));
+        }
+
+        REFLECTOR_CONSTEXPR iterator_t begin() const noexcept { return iterator_t(m_buffer); }
+        REFLECTOR_CONSTEXPR iterator_t end() const noexcept { return iterator_t(m_buffer + m_size * sizeof(T)); }
+
+        REFLECTOR_CONSTEXPR const std::byte *data() const noexcept { return m_buffer; }
+        REFLECTOR_CONSTEXPR size_t size() const noexcept { return m_size; }
+        REFLECTOR_CONSTEXPR bool empty() const noexcept { return m_size == 0; }
+};
+
+/**
+ * Reads and writes fixed-layout records of a reflected type through a file descriptor
+ * in large batches. Records are stored in the file with the exact in-memory layout of
+ * the type, so that batches can be read without any decoding and their records can
+ * be handed out as overlays into the stream's buffers, or even into the file's pages
+ * directly when the stream has been memory-mapped. Writes are queued into a buffer
+ * and sent to the file descriptor with gathering writes, so that a large span of
+ * records and the queued ones are written by a single system call.
+ * @tparam T The type of records within the stream.
+ * @since 1.0
+ */
+template <typename T>
+class record_stream_t
+{
+    static_assert(std::is_trivially_copyable_v<T>, "records must be trivially copyable");
+
+    public:
+        typedef T target_t;
+        typedef record_batch_t<T> batch_t;
+
+    public:
+        static constexpr size_t default_capacity = (sizeof(T) < (1 << 20)) ? (1 << 20) / sizeof(T) : 1;
+
+    private:
+        int m_fd = -1;
+        int m_error = 0;
+        stream_mode_t m_mode = stream_mode_t::buffered;
+        size_t m_capacity = 0;
+        std::byte *m_input = nullptr;
+        std::byte *m_output = nullptr;
+        size_t m_filled = 0;
+        size_t m_handed = 0;
+        size_t m_queued = 0;
+        void *m_window = nullptr;
+        size_t m_length = 0;
+        off_t m_position = 0;
+        off_t m_extent = 0;
+
+    public:
+        REFLECTOR_INLINE record_stream_t() noexcept = default;
+        REFLECTOR_INLINE record_stream_t(const record_stream_t&) noexcept = delete;
+
+        /**
+         * Moves a stream into a new instance, leaving the original one detached.
+         * @param other The stream to be moved.
+         */
+        REFLECTOR_INLINE record_stream_t(record_stream_t&& other) noexcept
+          : m_fd (std::exchange(other.m_fd, -1))
+          , m_error (std::exchange(other.m_error, 0))
+          , m_mode (other.m_mode)
+          , m_capacity (std::exchange(other.m_capacity, 0))
+          , m_input (std::exchange(other.m_input, nullptr))
+          , m_output (std::exchange(other.m_output, nullptr))
+          , m_filled (std::exchange(other.m_filled, 0))
+          , m_handed (std::exchange(other.m_handed, 0))
+          , m_queued (std::exchange(other.m_queued, 0))
+          , m_window (std::exchange(other.m_window, nullptr))
+          , m_length (std::exchange(other.m_length, 0))
+          , m_position (std::exchange(other.m_position, 0))
+          , m_extent (std::exchange(other.m_extent, 0))
+        {}
+
+        /**
+         * Attaches a stream to a file descriptor. The descriptor is not owned by the
+         * stream and must outlive it. Records are read from and written to the file
+         * descriptor's current position, which should be a multiple of the records'
+         * alignment for their members to be directly referenced through overlays.
+         * @param fd The file descriptor to stream records through.
+         * @param mode The strategy with which records are read.
+         * @param capacity The maximum number of records within a batch.
+         */
+        REFLECTOR_INLINE explicit record_stream_t(
+            int fd
+          , stream_mode_t mode = stream_mode_t::buffered
+          , size_t capacity = default_capacity
+        ) noexcept
+          : m_fd (fd)
+          , m_mode (mode)
+          , m_capacity (capacity > 0 ? capacity : 1)
+        {
+            m_position = ::lseek(fd, 0, SEEK_CUR);
+            m_position = m_position < 0 ? 0 : m_position;
+
+            if (mode == stream_mode_t::mapped) {
+                struct stat status;
+                if (::fstat(fd, &status) == 0) m_extent = status.st_size;
+                else m_error = errno;
+            }
+
+          #if defined(POSIX_FADV_SEQUENTIAL)
+            if (mode != stream_mode_t::buffered)
+                ::posix_fadvise(fd, m_position, 0, POSIX_FADV_SEQUENTIAL);
+          #endif
+        }
+
+        /**
+         * Writes the records still queued and releases the stream's buffers.
+         * @see record_stream_t::flush
+         */
+        REFLECTOR_INLINE ~record_stream_t()
+        {
+            flush();
+            release();
+        }
+
+        REFLECTOR_INLINE record_stream_t& operator=(const record_stream_t&) noexcept = delete;
+
+        /**
+         * Moves a stream into this instance, flushing and detaching the current one.
+         * @param other The stream to be moved.
+         * @return The current stream instance.
+         */
+        REFLECTOR_INLINE record_stream_t& operator=(record_stream_t&& other) noexcept
+        {
+            if (this != &other) {
+                this->~record_stream_t();
+                new (this) record_stream_t(std::move(other));
+            }
+
+            return *this;
+        }
+
+        /**
+         * Reads the next batch of records from the stream. Any records still queued for
+         * writing are flushed beforehand. The records of the previous batch are released,
+         * so overlays into them must not be used afterwards. An empty batch is returned
+         * when the stream is exhausted or if an error has occurred.
+         * @return The batch of records read from the stream.
+         */
+        REFLECTOR_INLINE batch_t next() noexcept
+        {
+            if (!flush())
+                return batch_t();
+
+            return m_mode == stream_mode_t::mapped
+                ? remap()
+                : refill();
+        }
+
+        /**
+         * Queues a record to be written to the stream.
+         * @param record The record to be written.
+         * @return Has the record been successfully queued?
+         */
+        REFLECTOR_INLINE bool write(const T& record) noexcept
+        {
+            if (m_output == nullptr && (m_output = allocate()) == nullptr)
+                return false;
+
+            if (m_queued == m_capacity && !flush())
+                return false;
+
+            std::memcpy(m_output + m_queued++ * sizeof(T), &record, sizeof(T));
+            return true;
+        }
+
+        /**
+         * Writes a span of records to the stream. Records which fit into the queue are
+         * simply copied into it. Otherwise, the queued records and the given span are
+         * written at once, without copying the span into the queue.
+         * @param records The records to be written.
+         * @return Have the records been successfully written?
+         */
+        REFLECTOR_INLINE bool write(span_t<const T> records) noexcept
+        {
+            if (m_queued + records.size() <= m_capacity) {
+                if (m_output == nullptr && (m_output = allocate()) == nullptr)
+                    return false;
+
+                std::memcpy(m_output + m_queued * sizeof(T), records.data(), records.size() * sizeof(T));
+                m_queued += records.size();
+                return true;
+            }
+
+            iovec chunks[2] = {
+                iovec {m_output, m_queued * sizeof(T)}
+              , iovec {const_cast<T*>(records.data()), records.size() * sizeof(T)}
+            };
+
+            m_queued = 0;
+            return gather(chunks, 2);
+        }
+
+        /**
+         * Writes all queued records to the file descriptor.
+         * @return Have the queued records been successfully written?
+         */
+        REFLECTOR_INLINE bool flush() noexcept
+        {
+            if (m_queued == 0)
+                return true;
+
+            iovec chunk = {m_output, m_queued * sizeof(T)};
+
+            m_queued = 0;
+            return gather(&chunk, 1);
+        }
+
+        /**
+         * Informs the last error which has occurred while operating on the stream.
+         * @return The last error number, or zero if no error has occurred.
+         */
+        REFLECTOR_INLINE int error() const noexcept
+        {
+            return m_error;
+        }
+
+        REFLECTOR_INLINE int descriptor() const noexcept { return m_fd; }
+        REFLECTOR_INLINE size_t capacity() const noexcept { return m_capacity; }
+        REFLECTOR_INLINE stream_mode_t mode() const noexcept { return m_mode; }
+
+    private:
+        /**
+         * Allocates a buffer suitably aligned for a batch of records.
+         * @return The allocated buffer, or null if allocation failed.
+         */
+        REFLECTOR_INLINE std::byte *allocate() noexcept
+        {
+            void *buffer = ::operator new(m_capacity * sizeof(T), std::align_val_t(alignof(T)), std::nothrow);
+            if (buffer == nullptr) m_error = ENOMEM;
+            return static_cast<std::byte*>(buffer);
+        }
+
+        /**
+         * Releases the stream's buffers and memory-mapped window.
+         */
+        REFLECTOR_INLINE void release() noexcept
+        {
+            if (m_input  != nullptr) ::operator delete(m_input, std::align_val_t(alignof(T)));
+            if (m_output != nullptr) ::operator delete(m_output, std::align_val_t(alignof(T)));
+            if (m_window != nullptr) ::munmap(m_window, m_length);
+            m_input = m_output = nullptr;
+            m_window = nullptr;
+        }
+
+        /**
+         * Asks the kernel to start fetching the contents of the next batch.
+         * @param position The file position of the next batch.
+         */
+        REFLECTOR_INLINE void prefetch([[maybe_unused]] off_t position) const noexcept
+        {
+          #if defined(POSIX_FADV_WILLNEED)
+            ::posix_fadvise(m_fd, position, m_capacity * sizeof(T), POSIX_FADV_WILLNEED);
+          #endif
+        }
+
+        /**
+         * Reads the next batch of records into the stream's buffer. The bytes of a
+         * record which has been only partially read are kept for the next batch.
+         * @return The batch of records read from the file descriptor.
+         */
+        REFLECTOR_INLINE batch_t refill() noexcept
+        {
+            if (m_input == nullptr && (m_input = allocate()) == nullptr)
+                return batch_t();
+
+            const size_t bytes = m_capacity * sizeof(T);
+            const size_t handed = m_handed * sizeof(T);
+
+            std::memmove(m_input, m_input + handed, m_filled - handed);
+            m_filled -= handed;
+
+            while (m_filled < bytes) {
+                ssize_t count = ::read(m_fd, m_input + m_filled, bytes - m_filled);
+                if (count < 0 && errno == EINTR) continue;
+                if (count < 0) m_error = errno;
+                if (count <= 0) break;
+                m_filled += static_cast<size_t>(count);
+                m_position += count;
+            }
+
+            if (m_mode == stream_mode_t::prefetched)
+                prefetch(m_position);
+
+            m_handed = m_filled / sizeof(T);
+            return batch_t(m_input, m_handed);
+        }
+
+        /**
+         * Maps the next batch of records directly from the file into memory. As the
+         * file's pages are shared with the kernel's cache, records are not copied at all.
+         * @return The batch of records mapped from the file.
+         */
+        REFLECTOR_INLINE batch_t remap() noexcept
+        {
+            if (m_window != nullptr)
+                ::munmap(m_window, m_length);
+
+            m_window = nullptr;
+            m_length = 0;
+
+            const size_t available = m_position < m_extent ? static_cast<size_t>(m_extent - m_position) : 0;
+            const size_t records = std::min(m_capacity, available / sizeof(T));
+
+            if (records == 0)
+                return batch_t();
+
+            const off_t page = static_cast<off_t>(::sysconf(_SC_PAGESIZE));
+            const off_t start = m_position - m_position % page;
+            const size_t length = static_cast<size_t>(m_position - start) + records * sizeof(T);
+
+            void *window = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, m_fd, start);
+
+            if (window == MAP_FAILED) {
+                m_error = errno;
+                return batch_t();
+            }
+
+          #if defined(MADV_SEQUENTIAL)
+            ::madvise(window, length, MADV_SEQUENTIAL);
+          #endif
+
+            const auto *buffer = static_cast<const std::byte*>(window) + (m_position - start);
+
+            m_window = window;
+            m_length = length;
+            m_position += static_cast<off_t>(records * sizeof(T));
+            prefetch(m_position);
+
+            return batch_t(buffer, records);
+        }
+
+        /**
+         * Writes a sequence of buffers to the file descriptor, retrying after partial
+         * writes until all of them have been completely written.
+         * @param chunks The buffers to be written.
+         * @param count The number of buffers to be written.
+         * @return Have the buffers been successfully written?
+         */
+        REFLECTOR_INLINE bool gather(iovec *chunks, int count) noexcept
+        {
+            while (count > 0) {
+                ssize_t written = ::writev(m_fd, chunks, count);
+
+                if (written < 0 && errno == EINTR) continue;
+                if (written < 0) { m_error = errno; return false; }
+
+                auto remaining = static_cast<size_t>(written);
+
+                for (; count > 0 && remaining >= chunks->iov_len; ++chunks, --count)
+                    remaining -= chunks->iov_len;
+
+                if (count > 0) {
+                    chunks->iov_base = static_cast<std::byte*>(chunks->iov_base) + remaining;
+                    chunks->iov_len -= remaining;
+                }
+            }
+
+            return true;
+        }
+};
+
+REFLECTOR_END_NAMESPACE
@@ -0,0 +1,465 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The reflection of tagged unions, for variant-like records.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/detail/tuple.hpp>
+#include <reflector/reflector.hpp>
+#include <reflector/algorithm.hpp>
+#include <reflector/serializer.hpp>
+#include <reflector/hash.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * The tagged union provider for a specified type. A type is reflected as a tagged
+ * union by specializing its provider, usually through the tagged declaration macro.
+ * @tparam T The type to be reflected as a tagged union.
+ * @see REFLECTOR_DECLARE_TAGGED
+ * @since 1.0
+ */
+template <typename T>
+struct tagged_provider_t;
+
+namespace detail
+{
+    /**
+     * Decomposes a member pointer into its class and member types.
+     * @tparam M The member pointer type.
+     * @since 1.0
+     */
+    template <typename M>
+    struct member_pointer_t;
+
+    template <typename T, typename R>
+    struct member_pointer_t<R T::*>
+    {
+        typedef T class_t;
+        typedef R member_t;
+    };
+}
+
+/**
+ * Checks whether a type has been declared as a tagged union.
+ * @tparam T The type to be checked.
+ * @since 1.0
+ */
+template <typename T, typename = void>
+inline constexpr bool is_tagged_v = false;
+
+template <typename T>
+inline constexpr bool is_tagged_v<T, std::void_t<decltype(sizeof(tagged_provider_t<T>))>> = true;
+
+/**
+ * The descriptor of a tagged union. A tagged union is a type with a discriminant
+ * member and a union member, whose active alternative is selected by the value of
+ * the discriminant. The discriminant's value is the index of its active alternative
+ * within the descriptor's alternatives list. Visitors are dispatched to the active
+ * alternative through a table of functions, built at compile-time.
+ * @tparam D The pointer to the discriminant member.
+ * @tparam U The pointer to the union member.
+ * @tparam A The union member's alternative types.
+ * @since 1.0
+ */
+template <auto D, auto U, typename ...A>
+struct tagged_t
+{
+    typedef typename detail::member_pointer_t<decltype(D)>::class_t target_t;
+    typedef typename detail::member_pointer_t<decltype(D)>::member_t discriminant_t;
+    typedef typename detail::member_pointer_t<decltype(U)>::member_t union_t;
+
+    static_assert(
+        std::is_same_v<typename detail::member_pointer_t<decltype(U)>::class_t, target_t>
+      , "the discriminant and union must be members of the same type");
+    static_assert(std::is_integral_v<discriminant_t> || std::is_enum_v<discriminant_t>
+      , "the discriminant must be an integral or enumeration type");
+    static_assert(std::is_union_v<union_t>, "the alternatives must be held by a union member");
+    static_assert(((sizeof(A) <= sizeof(union_t)) && ...), "the alternatives must fit within the union");
+
+    static constexpr size_t count = sizeof...(A);
+
+    /**
+     * The type of one of the tagged union's alternatives.
+     * @tparam N The index of the requested alternative.
+     * @since 1.0
+     */
+    template <size_t N>
+    using alternative_t = typename supertuple::tuple_t<A...>::template element_t<N>;
+
+    /**
+     * Retrieves the index of a tagged union's active alternative.
+     * @param target The tagged union instance.
+     * @return The index of the active alternative, which might be out of range.
+     */
+    REFLECTOR_CONSTEXPR static size_t discriminant(const target_t& target) noexcept
+    {
+        return static_cast<size_t>(target.*D);
+    }
+
+    /**
+     * Retrieves a tagged union's discriminant member.
+     * @tparam Q The tagged union type, possibly const-qualified.
+     * @param target The tagged union instance.
+     * @return The discriminant member's reference.
+     */
+    template <typename Q>
+    REFLECTOR_CONSTEXPR static auto tag(Q& target) noexcept -> detail::copy_const_t<Q, discriminant_t>&
+    {
+        static_assert(std::is_same_v<std::remove_const_t<Q>, target_t>, "incompatible tagged union");
+        return target.*D;
+    }
+
+    /**
+     * Retrieves one of a tagged union's alternatives.
+     * @tparam N The index of the requested alternative.
+     * @tparam Q The tagged union type, possibly const-qualified.
+     * @param target The tagged union instance.
+     * @return The alternative's reference.
+     */
+    template <size_t N, typename Q>
+    REFLECTOR_INLINE static auto alternative(Q& target) noexcept
+    -> detail::copy_const_t<Q, alternative_t<N>>&
+    {
+        static_assert(std::is_same_v<std::remove_const_t<Q>, target_t>, "incompatible tagged union");
+        return *reinterpret_cast<detail::copy_const_t<Q, alternative_t<N>>*>(&(target.*U));
+    }
+
+    /**
+     * Activates one of a tagged union's alternatives.
+     * @tparam N The index of the alternative to be activated.
+     * @param target The tagged union instance.
+     * @param value The alternative's value.
+     */
+    template <size_t N>
+    REFLECTOR_INLINE static void select(target_t& target, const alternative_t<N>& value) noexcept
+    {
+        target.*D = static_cast<discriminant_t>(N);
+        std::memcpy(&(target.*U), &value, sizeof(alternative_t<N>));
+    }
+
+    /**
+     * Visits the active alternative of a tagged union. The visitor may also take the
+     * index of the active alternative, as an integral constant, after the alternative.
+     * @tparam Q The tagged union type, possibly const-qualified.
+     * @tparam F The visitor type, which must be invocable with all alternatives.
+     * @param target The tagged union instance.
+     * @param visitor The visitor to invoke with the active alternative.
+     * @return Is the tagged union's discriminant valid?
+     */
+    template <typename Q, typename F>
+    REFLECTOR_INLINE static bool visit(Q& target, F&& visitor)
+    {
+        const size_t index = discriminant(target);
+
+        if (index >= count)
+            return false;
+
+        dispatch_t<Q, std::remove_reference_t<F>>::table[index](target, visitor);
+        return true;
+    }
+
+    private:
+        /**
+         * Builds the table of functions dispatching a visitor to each alternative.
+         * @tparam Q The tagged union type, possibly const-qualified.
+         * @tparam F The visitor type.
+         * @tparam I The alternatives index sequence.
+         * @since 1.0
+         */
+        template <typename Q, typename F, typename I = std::make_index_sequence<count>>
+        struct dispatch_t;
+
+        template <typename Q, typename F, size_t ...I>
+        struct dispatch_t<Q, F, std::index_sequence<I...>>
+        {
+            /**
+             * Invokes the visitor with a reference to an alternative, along with the
+             * alternative's index if the visitor accepts it.
+             * @tparam N The index of the alternative to be visited.
+             * @param target The tagged union instance.
+             * @param visitor The visitor to invoke with the alternative.
+             */
+            template <size_t N>
+            REFLECTOR_INLINE static void invoke(Q& target, F& visitor)
+            {
+                using index_t = std::integral_constant<size_t, N>;
+
+                if constexpr (std::is_invocable_v<F&, decltype(alternative<N>(target)), index_t>)
+                    visitor(alternative<N>(target), index_t());
+                else
+                    visitor(alternative<N>(target));
+            }
+
+            static constexpr void (*table[])(Q&, F&) = {&invoke<I>...};
+        };
+};
+
+namespace detail
+{
+    /**
+     * Visits each member of an alternative. Alternatives which are not classes are
+     * visited as a single member.
+     * @tparam E The alternative type, possibly const-qualified.
+     * @tparam F The visitor type.
+     * @tparam I The members index sequence.
+     * @param alternative The alternative to be visited.
+     * @param visitor The visitor to invoke with each member.
+     */
+    template <typename E, typename F, size_t ...I>
+    REFLECTOR_INLINE void visit_fields(E& alternative, F& visitor, std::index_sequence<I...>)
+    {
+        (visitor(reflection_t<std::remove_const_t<E>>::template member<I>(alternative)), ...);
+    }
+
+    /**
+     * Serializes an alternative. Alternatives which are not classes are copied as is.
+     * @tparam E The alternative type.
+     * @param value The alternative to be serialized.
+     * @param buffer The buffer to serialize the alternative into.
+     * @return The buffer position just after the serialized alternative.
+     */
+    template <typename E>
+    REFLECTOR_INLINE std::byte *serialize_alternative(const E& value, std::byte *buffer) noexcept
+    {
+        if constexpr (std::is_class_v<E>) {
+            return reflector::serialize(value, buffer);
+        } else {
+            std::memcpy(buffer, &value, sizeof(E));
+            return buffer + sizeof(E);
+        }
+    }
+
+    /**
+     * Deserializes an alternative. Alternatives which are not classes are copied as is.
+     * @tparam E The alternative type.
+     * @param buffer The buffer to deserialize the alternative from.
+     * @param value The alternative to be deserialized into.
+     * @return The buffer position just after the deserialized alternative.
+     */
+    template <typename E>
+    REFLECTOR_INLINE const std::byte *deserialize_alternative(const std::byte *buffer, E& value) noexcept
+    {
+        if constexpr (std::is_class_v<E>) {
+            return reflector::deserialize(buffer, value);
+        } else {
+            std::memcpy(&value, buffer, sizeof(E));
+            return buffer + sizeof(E);
+        }
+    }
+
+    /**
+     * Informs the number of bytes an alternative occupies when serialized.
+     * @tparam E The alternative type.
+     * @since 1.0
+     */
+    template <typename E>
+    inline constexpr size_t alternative_size_v = []() {
+        if constexpr (std::is_class_v<E>) return serialized_size_v<E>;
+        else return sizeof(E);
+    }();
+}
+
+/**
+ * Visits the active alternative of a tagged union.
+ * @tparam T The tagged union type, possibly const-qualified.
+ * @tparam F The visitor type, which must be invocable with all alternatives.
+ * @param target The tagged union instance.
+ * @param visitor The visitor to invoke with the active alternative.
+ * @return Is the tagged union's discriminant valid?
+ */
+template <typename T, typename F>
+REFLECTOR_INLINE bool visit_alternative(T& target, F&& visitor)
+{
+    return tagged_provider_t<std::remove_const_t<T>>::visit(target, visitor);
+}
+
+/**
+ * Visits the discriminant of a tagged union, and then each member of its active
+ * alternative. Thus, a tagged union can be walked through just as a plain type.
+ * @tparam T The tagged union type, possibly const-qualified.
+ * @tparam F The visitor type, which must be invocable with all members.
+ * @param target The tagged union instance.
+ * @param visitor The visitor to invoke with each member.
+ * @return Is the tagged union's discriminant valid?
+ */
+template <typename T, typename F>
+REFLECTOR_INLINE bool visit_tagged_fields(T& target, F&& visitor)
+{
+    using provider_t = tagged_provider_t<std::remove_const_t<T>>;
+
+    visitor(provider_t::tag(target));
+
+    return provider_t::visit(target, [&visitor](auto& alternative) {
+        using E = std::remove_const_t<std::remove_reference_t<decltype(alternative)>>;
+        if constexpr (std::is_class_v<E>) {
+            detail::visit_fields(alternative, visitor, std::make_index_sequence<reflection_t<E>::count>());
+        } else {
+            visitor(alternative);
+        }
+    });
+}
+
+/**
+ * Informs the number of bytes a tagged union instance occupies when serialized. Only
+ * the discriminant and the active alternative are serialized.
+ * @tparam T The tagged union type to be serialized.
+ * @param value The instance to be serialized.
+ * @return The instance's serialized size.
+ */
+template <typename T>
+REFLECTOR_INLINE size_t tagged_serialized_size(const T& value) noexcept
+{
+    using provider_t = tagged_provider_t<T>;
+    size_t size = sizeof(typename provider_t::discriminant_t);
+
+    provider_t::visit(value, [&size](const auto& alternative) {
+        size += detail::alternative_size_v<std::decay_t<decltype(alternative)>>;
+    });
+
+    return size;
+}
+
+/**
+ * Serializes a tagged union instance into a buffer. The discriminant is written first,
+ * followed by the packed active alternative.
+ * @tparam T The tagged union type to be serialized.
+ * @param source The instance to be serialized.
+ * @param buffer The buffer to serialize the instance into.
+ * @return The buffer position just after the serialized instance, or null if the
+ * instance's discriminant is not valid, in which case the buffer is left untouched.
+ */
+template <typename T>
+REFLECTOR_INLINE std::byte *serialize_tagged(const T& source, std::byte *buffer) noexcept
+{
+    using provider_t = tagged_provider_t<T>;
+    using discriminant_t = typename provider_t::discriminant_t;
+
+    if (provider_t::discriminant(source) >= provider_t::count)
+        return nullptr;
+
+    std::memcpy(buffer, &provider_t::tag(source), sizeof(discriminant_t));
+    std::byte *result = nullptr;
+
+    provider_t::visit(source, [&](const auto& alternative) {
+        result = detail::serialize_alternative(alternative, buffer + sizeof(discriminant_t));
+    });
+
+    return result;
+}
+
+/**
+ * Deserializes a tagged union instance from a buffer. The alternative selected by the
+ * serialized discriminant is activated and deserialized.
+ * @tparam T The tagged union type to be deserialized.
+ * @param buffer The buffer to deserialize the instance from.
+ * @param target The instance to be deserialized into.
+ * @return The buffer position just after the deserialized instance, or null if the
+ * serialized discriminant is not valid, in which case the instance is left untouched.
+ */
+template <typename T>
+REFLECTOR_INLINE const std::byte *deserialize_tagged(const std::byte *buffer, T& target) noexcept
+{
+    using provider_t = tagged_provider_t<T>;
+    using discriminant_t = typename provider_t::discriminant_t;
+
+    discriminant_t tag;
+    std::memcpy(&tag, buffer, sizeof(discriminant_t));
+
+    if (static_cast<size_t>(tag) >= provider_t::count)
+        return nullptr;
+
+    provider_t::tag(target) = tag;
+    const std::byte *result = nullptr;
+
+    provider_t::visit(target, [&](auto& alternative) {
+        result = detail::deserialize_alternative(buffer + sizeof(discriminant_t), alternative);
+    });
+
+    return result;
+}
+
+/**
+ * Hashes tagged union instances by their discriminant and active alternative. The
+ * inactive alternatives' bytes do not affect the produced hash.
+ * @tparam T The tagged union type to be hashed.
+ * @since 1.0
+ */
+template <typename T>
+struct tagged_hash_t
+{
+    /**
+     * Hashes a tagged union instance.
+     * @param value The instance to be hashed.
+     * @return The instance's hash.
+     */
+    REFLECTOR_INLINE size_t operator()(const T& value) const noexcept
+    {
+        size_t seed = tagged_provider_t<T>::discriminant(value);
+
+        tagged_provider_t<T>::visit(value, [&seed](const auto& alternative) {
+            seed ^= detail::hash(alternative) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        });
+
+        return seed;
+    }
+};
+
+/**
+ * Compares tagged union instances by their discriminant and active alternative.
+ * @tparam T The tagged union type to be compared.
+ * @since 1.0
+ */
+template <typename T>
+struct tagged_equal_to_t
+{
+    /**
+     * Compares two tagged union instances.
+     * @param a The first instance to be compared.
+     * @param b The second instance to be compared.
+     * @return Are both instances equal?
+     */
+    REFLECTOR_INLINE bool operator()(const T& a, const T& b) const noexcept
+    {
+        using provider_t = tagged_provider_t<T>;
+        bool result = provider_t::discriminant(a) == provider_t::discriminant(b);
+
+        if (result) {
+            provider_t::visit(a, [&](const auto& alternative, auto index) {
+                result = detail::equal(alternative, provider_t::template alternative<decltype(index)::value>(b));
+            });
+        }
+
+        return result;
+    }
+};
+
+REFLECTOR_END_NAMESPACE
+
+/**
+ * Declares a type as a tagged union, so that it can be reflected over, serialized
+ * and hashed by its active alternative. This macro must be used in the global namespace.
+ * @param T The tagged union type.
+ * @param D The pointer to the discriminant member.
+ * @param U The pointer to the union member.
+ * @param ... The union member's alternative types, in discriminant order.
+ * @since 1.0
+ */
+#define REFLECTOR_DECLARE_TAGGED(T, D, U, ...)                                  \
+    template <>                                                                 \
+    struct REFLECTOR_NAMESPACE::tagged_provider_t<T>                            \
+      : public REFLECTOR_NAMESPACE::tagged_t<D, U, __VA_ARGS__> {};             \
+    template <>                                                                 \
+    struct REFLECTOR_NAMESPACE::hash_t<T>                                       \
+      : public REFLECTOR_NAMESPACE::tagged_hash_t<T> {};                        \
+    template <>                                                                 \
+    struct REFLECTOR_NAMESPACE::equal_to_t<T>                                   \
+      : public REFLECTOR_NAMESPACE::tagged_equal_to_t<T> {};
@@ -0,0 +1,213 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Opt-in instrumentation of reflected types' usage.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+#include <reflector/environment.h>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * The usage record of a reflected type. Records are only produced when tracing has
+ * been enabled at compile-time, and each reflected type is registered only once,
+ * when it is first reflected over.
+ * @since 1.0
+ */
+struct trace_record_t
+{
+    std::string_view name;
+    size_t count, size, padding;
+    std::atomic<uint64_t> instances {0};
+    std::atomic<uint64_t> *accesses = nullptr;
+    const trace_record_t *next = nullptr;
+};
+
+/**
+ * The hook type, which is invoked with sampled accesses to reflected members.
+ * @since 1.0
+ */
+typedef void (*trace_hook_t)(const trace_record_t&, size_t);
+
+namespace detail
+{
+    /**
+     * The global tracing state, with the list of registered types and the hook.
+     * @since 1.0
+     */
+    struct trace_state_t
+    {
+        std::atomic<const trace_record_t*> head {nullptr};
+        std::atomic<trace_hook_t> hook {nullptr};
+        std::atomic<uint64_t> period {1};
+        std::atomic<uint64_t> ticks {0};
+    };
+
+    /**
+     * Retrieves the global tracing state, which is shared by all translation units.
+     * @return The global tracing state.
+     */
+    inline trace_state_t& trace_state() noexcept
+    {
+        static trace_state_t state;
+        return state;
+    }
+
+    /**
+     * Extracts a type's name from the compiler's signature of a function.
+     * @tparam T The type to be named.
+     * @return The type's name as produced by the compiler.
+     */
+    template <typename T>
+    REFLECTOR_CONSTEXPR std::string_view type_name() noexcept
+    {
+      #if REFLECTOR_HOST_COMPILER != REFLECTOR_HOST_COMPILER_UNKNOWN
+        constexpr std::string_view signature = __PRETTY_FUNCTION__;
+        constexpr size_t first = signature.find("T = ") + 4;
+        constexpr size_t last = signature.find_first_of(";]", first);
+        return signature.substr(first, last - first);
+      #else
+        return "unknown";
+      #endif
+    }
+
+    /**
+     * Keeps the usage record of a reflected type.
+     * @tparam T The reflected type to be traced.
+     * @tparam C The number of members in the reflected type.
+     * @tparam P The number of padding bytes in the reflected type.
+     * @since 1.0
+     */
+    template <typename T, size_t C, size_t P>
+    struct trace_t
+    {
+        /**
+         * Retrieves the type's usage record, registering it on its first use.
+         * @return The type's usage record.
+         */
+        static trace_record_t& record() noexcept
+        {
+            static trace_record_t *instance = enroll();
+            return *instance;
+        }
+
+        /**
+         * Counts a new reflection over an instance of the type.
+         */
+        static void instance() noexcept
+        {
+            record().instances.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        /**
+         * Counts an access to one of the type's members, and samples it to the hook.
+         * @param field The index of the accessed member.
+         */
+        static void access(size_t field) noexcept
+        {
+            trace_record_t& target = record();
+            trace_state_t& state = trace_state();
+
+            target.accesses[field].fetch_add(1, std::memory_order_relaxed);
+
+            if (trace_hook_t hook = state.hook.load(std::memory_order_relaxed)) {
+                const uint64_t tick = state.ticks.fetch_add(1, std::memory_order_relaxed);
+                if (tick % state.period.load(std::memory_order_relaxed) == 0)
+                    hook(target, field);
+            }
+        }
+
+        private:
+            /**
+             * Registers the type's usage record into the global list of records.
+             * @return The registered usage record.
+             */
+            static trace_record_t *enroll() noexcept
+            {
+                static std::atomic<uint64_t> accesses[C > 0 ? C : 1] {};
+                static trace_record_t instance;
+
+                instance.name = type_name<T>();
+                instance.count = C;
+                instance.size = sizeof(T);
+                instance.padding = P;
+                instance.accesses = accesses;
+
+                auto& head = trace_state().head;
+                instance.next = head.load(std::memory_order_relaxed);
+                while (!head.compare_exchange_weak(instance.next, &instance, std::memory_order_release));
+
+                return &instance;
+            }
+    };
+}
+
+/**
+ * Installs the hook to be invoked with sampled accesses to reflected members. The hook
+ * is only ever invoked when tracing has been enabled at compile-time.
+ * @param hook The hook to be installed, or null to uninstall the current hook.
+ * @param period The number of member accesses between each sampled access.
+ */
+inline void set_trace_hook(trace_hook_t hook, uint64_t period = 1) noexcept
+{
+    auto& state = detail::trace_state();
+    state.period.store(period > 0 ? period : 1, std::memory_order_relaxed);
+    state.hook.store(hook, std::memory_order_release);
+}
+
+/**
+ * Visits the usage records of all reflected types registered so far.
+ * @tparam F The visitor type.
+ * @param visitor The visitor to invoke with each usage record.
+ */
+template <typename F>
+inline void for_each_trace(F&& visitor)
+{
+    auto record = detail::trace_state().head.load(std::memory_order_acquire);
+    for (; record != nullptr; record = record->next)
+        visitor(*record);
+}
+
+REFLECTOR_END_NAMESPACE
+
+/*
+ * Detects whether the current evaluation is a constant evaluation, within which member
+ * accesses must not be instrumented. The standard detection is only available from
+ * C++20 onwards, so known compilers' built-in detection is used otherwise.
+ */
+#if defined(__cpp_lib_is_constant_evaluated)
+  #define REFLECTOR_TRACE_CONSTANT_EVALUATED() std::is_constant_evaluated()
+#elif REFLECTOR_HOST_COMPILER != REFLECTOR_HOST_COMPILER_UNKNOWN
+  #define REFLECTOR_TRACE_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+/*
+ * The instrumentation points of reflected types. When tracing is disabled, these are
+ * defined to expand to nothing by the environment instead. Instrumentation is also
+ * skipped within device code and during constant evaluation. When constant evaluation
+ * cannot be detected, member accesses are never instrumented.
+ */
+#if REFLECTOR_TRACE_ENABLED && !defined(__CUDA_ARCH__)
+  #define REFLECTOR_TRACE_INSTANCE(T, D)                                        \
+    REFLECTOR_NAMESPACE::detail::trace_t<T, D::count, sizeof(T) - D::packed_size>::instance()
+  #if defined(REFLECTOR_TRACE_CONSTANT_EVALUATED)
+    #define REFLECTOR_TRACE_ACCESS(T, D, N)                                     \
+      do {                                                                      \
+          if (!REFLECTOR_TRACE_CONSTANT_EVALUATED())                            \
+              REFLECTOR_NAMESPACE::detail::trace_t<T, D::count, sizeof(T) - D::packed_size>::access(N); \
+      } while (0)
+  #else
+    #define REFLECTOR_TRACE_ACCESS(T, D, N)
+  #endif
+#elif REFLECTOR_TRACE_ENABLED
+  #define REFLECTOR_TRACE_INSTANCE(T, D)
+  #define REFLECTOR_TRACE_ACCESS(T, D, N)
+#endif
@@ -0,0 +1,271 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file The lazy, storage-free reflection views implementation.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+/**
+ * Reflects over an instance without gathering references to its members upfront.
+ * Instead, only a pointer to the target instance is kept and each member property
+ * is resolved on demand from the target type's layout, so that creating a view is
+ * as cheap as copying a pointer, independently of the number of members.
+ * @tparam T The target data type to be introspected.
+ * @since 1.0
+ */
+template <typename T>
+class reflection_view_t
+{
+    public:
+        typedef T target_t;
+
+    private:
+        typedef reflection_t<std::remove_const_t<T>> underlying_t;
+
+    public:
+        using reflection_tuple_t = typename underlying_t::reflection_tuple_t;
+        using reference_tuple_t = typename underlying_t::reference_tuple_t;
+
+        /**
+         * The type of a member reference of the viewed instance, which propagates
+         * the target instance's constness to its members.
+         * @tparam N The index of the requested member.
+         * @since 1.0
+         */
+        template <size_t N>
+        using element_t = std::conditional_t<
+            std::is_const_v<T>
+          , const typename reflection_tuple_t::template element_t<N>&
+          , typename reflection_tuple_t::template element_t<N>&>;
+
+    public:
+        static constexpr size_t count = reflection_tuple_t::count;
+
+    private:
+        T *m_target;
+
+    public:
+        REFLECTOR_INLINE reflection_view_t() noexcept = delete;
+        REFLECTOR_CONSTEXPR reflection_view_t(const reflection_view_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR reflection_view_t(reflection_view_t&&) noexcept = default;
+
+        /**
+         * Reflects over an instance without retrieving references to its members.
+         * @param target The target instance to be viewed.
+         */
+        REFLECTOR_CONSTEXPR reflection_view_t(T& target) noexcept
+          : m_target (&target)
+        {}
+
+        REFLECTOR_CONSTEXPR reflection_view_t& operator=(const reflection_view_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR reflection_view_t& operator=(reflection_view_t&&) noexcept = default;
+
+        /**
+         * Retrieves a reference to a member of the viewed instance by its index.
+         * @tparam N The requested property member index.
+         * @return The viewed instance's member reference.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR auto get() const noexcept -> element_t<N>
+        {
+            return underlying_t::template member<N>(*m_target);
+        }
+
+        /**
+         * Retrieves the offset of a member of the viewed type by its index.
+         * @tparam N The index of required member.
+         * @return The member offset.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto offset() noexcept -> ptrdiff_t
+        {
+            return underlying_t::template offset<N>();
+        }
+
+        /**
+         * Retrieves the instance being viewed.
+         * @return The viewed instance reference.
+         */
+        REFLECTOR_CONSTEXPR auto target() const noexcept -> T&
+        {
+            return *m_target;
+        }
+};
+
+/**
+ * Reflects over a raw memory buffer as if it held an instance of the target type.
+ * Members are located within the buffer by the target type's layout, so that records
+ * stored in memory-mapped files or network buffers can be reflected over without
+ * being copied into an instance first.
+ * @tparam T The target data type to be overlaid onto the buffer.
+ * @since 1.0
+ */
+template <typename T>
+class overlay_t
+{
+    public:
+        typedef T target_t;
+
+    private:
+        typedef reflection_t<std::remove_const_t<T>> underlying_t;
+        typedef std::conditional_t<std::is_const_v<T>, const std::byte, std::byte> byte_t;
+
+    public:
+        using reflection_tuple_t = typename underlying_t::reflection_tuple_t;
+
+        /**
+         * The type of a member reference within the overlaid buffer, which propagates
+         * the buffer's constness to its members.
+         * @tparam N The index of the requested member.
+         * @since 1.0
+         */
+        template <size_t N>
+        using element_t = typename reflection_view_t<T>::template element_t<N>;
+
+    public:
+        static constexpr size_t count = reflection_tuple_t::count;
+
+    private:
+        byte_t *m_buffer;
+
+    public:
+        REFLECTOR_INLINE overlay_t() noexcept = delete;
+        REFLECTOR_CONSTEXPR overlay_t(const overlay_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR overlay_t(overlay_t&&) noexcept = default;
+
+        /**
+         * Overlays the target type onto a raw memory buffer.
+         * @param buffer The buffer to be reflected over.
+         */
+        REFLECTOR_CONSTEXPR explicit overlay_t(byte_t *buffer) noexcept
+          : m_buffer (buffer)
+        {}
+
+        REFLECTOR_CONSTEXPR overlay_t& operator=(const overlay_t&) noexcept = default;
+        REFLECTOR_CONSTEXPR overlay_t& operator=(overlay_t&&) noexcept = default;
+
+        /**
+         * Retrieves a reference to a member within the overlaid buffer. The buffer must
+         * be suitably aligned for the target type. Otherwise, members must be accessed
+         * through the alignment-safe load and store methods.
+         * @tparam N The requested property member index.
+         * @return The overlaid member reference.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE auto get() const noexcept -> element_t<N>
+        {
+            using E = std::remove_reference_t<element_t<N>>;
+            return *reinterpret_cast<E*>(m_buffer + offset<N>());
+        }
+
+        /**
+         * Reads the value of a member from the overlaid buffer, independently of the
+         * buffer's alignment.
+         * @tparam N The requested property member index.
+         * @return The overlaid member's value.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE auto load() const noexcept -> typename reflection_tuple_t::template element_t<N>
+        {
+            typename reflection_tuple_t::template element_t<N> value;
+            std::memcpy(&value, m_buffer + offset<N>(), sizeof(value));
+            return value;
+        }
+
+        /**
+         * Writes the value of a member into the overlaid buffer, independently of the
+         * buffer's alignment.
+         * @tparam N The requested property member index.
+         * @param value The value to be written to the overlaid member.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE void store(const typename reflection_tuple_t::template element_t<N>& value) const noexcept
+        {
+            static_assert(!std::is_const_v<T>, "cannot write into a constant buffer");
+            std::memcpy(m_buffer + offset<N>(), &value, sizeof(value));
+        }
+
+        /**
+         * Retrieves the offset of a member of the overlaid type by its index.
+         * @tparam N The index of required member.
+         * @return The member offset.
+         */
+        template <size_t N>
+        REFLECTOR_CONSTEXPR static auto offset() noexcept -> ptrdiff_t
+        {
+            return underlying_t::template offset<N>();
+        }
+
+        /**
+         * Checks whether the overlaid buffer is suitably aligned for the target type,
+         * so that its members can be directly referenced.
+         * @return Is the buffer aligned for the target type?
+         */
+        REFLECTOR_INLINE bool aligned() const noexcept
+        {
+            return reinterpret_cast<uintptr_t>(m_buffer) % alignof(T) == 0;
+        }
+
+        /**
+         * Retrieves the overlaid buffer.
+         * @return The overlaid buffer pointer.
+         */
+        REFLECTOR_CONSTEXPR auto data() const noexcept -> byte_t*
+        {
+            return m_buffer;
+        }
+};
+
+REFLECTOR_END_NAMESPACE
+
+/**
+ * Informs the size of a reflection view, allowing it to be deconstructed.
+ * @tparam T The target type for reflection.
+ * @since 1.0
+ */
+template <typename T>
+struct std::tuple_size<REFLECTOR_NAMESPACE::reflection_view_t<T>>
+  : std::integral_constant<size_t, REFLECTOR_NAMESPACE::reflection_view_t<T>::count> {};
+
+/**
+ * Retrieves the deconstruction type of a reflection view's element.
+ * @tparam I The index of the requested view element.
+ * @tparam T The target type for reflection.
+ * @since 1.0
+ */
+template <size_t I, typename T>
+struct std::tuple_element<I, REFLECTOR_NAMESPACE::reflection_view_t<T>> {
+    using type = typename REFLECTOR_NAMESPACE::reflection_view_t<T>::template element_t<I>;
+};
+
+/**
+ * Informs the size of an overlay reflection, allowing it to be deconstructed.
+ * @tparam T The target type for reflection.
+ * @since 1.0
+ */
+template <typename T>
+struct std::tuple_size<REFLECTOR_NAMESPACE::overlay_t<T>>
+  : std::integral_constant<size_t, REFLECTOR_NAMESPACE::overlay_t<T>::count> {};
+
+/**
+ * Retrieves the deconstruction type of an overlay reflection's element.
+ * @tparam I The index of the requested overlay element.
+ * @tparam T The target type for reflection.
+ * @since 1.0
+ */
+template <size_t I, typename T>
+struct std::tuple_element<I, REFLECTOR_NAMESPACE::overlay_t<T>> {
+    using type = typename REFLECTOR_NAMESPACE::overlay_t<T>::template element_t<I>;
+};
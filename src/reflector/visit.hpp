@@ -0,0 +1,82 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Dispatch of visitors to reflected members chosen at run-time.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <type_traits>
+
+#include <reflector/environment.h>
+#include <reflector/reflector.hpp>
+
+REFLECTOR_BEGIN_NAMESPACE
+
+namespace detail
+{
+    /**
+     * Builds the table of functions dispatching a visitor to each member of a type.
+     * @tparam T The reflected type to be visited, possibly const-qualified.
+     * @tparam F The visitor type.
+     * @tparam I The members index sequence.
+     * @since 1.0
+     */
+    template <typename T, typename F, typename I>
+    struct dispatch_t;
+
+    template <typename T, typename F, size_t ...I>
+    struct dispatch_t<T, F, std::index_sequence<I...>>
+    {
+        typedef reflection_t<std::remove_const_t<T>> underlying_t;
+
+        template <size_t N>
+        using member_t = decltype(underlying_t::template member<N>(std::declval<T&>()));
+
+        using result_t = std::invoke_result_t<F&, member_t<0>>;
+
+        static_assert(
+            (std::is_same_v<result_t, std::invoke_result_t<F&, member_t<I>>> && ...)
+          , "the visitor must return the same type for all members"
+        );
+
+        /**
+         * Invokes the visitor with a reference to one of the instance's members.
+         * @tparam N The index of the member to be visited.
+         * @param target The instance to be visited.
+         * @param visitor The visitor to invoke with the member.
+         * @return The visitor's result.
+         */
+        template <size_t N>
+        REFLECTOR_INLINE static result_t invoke(T& target, F& visitor)
+        {
+            return visitor(underlying_t::template member<N>(target));
+        }
+
+        static constexpr result_t (*table[])(T&, F&) = {&invoke<I>...};
+    };
+}
+
+/**
+ * Visits a member of a reflected instance chosen by its index at run-time. Rather than
+ * comparing the index with each member in turn, the visitor is dispatched through a
+ * table of functions, one for each member, built at compile-time. Therefore, visiting
+ * any member costs a single indirect call, regardless of the number of members.
+ * @tparam T The reflected type to be visited, possibly const-qualified.
+ * @tparam F The visitor type, which must be invocable with references to all members.
+ * @param target The instance to be visited.
+ * @param index The index of the member to be visited. Must be less than the number of members.
+ * @param visitor The visitor to invoke with a reference to the member.
+ * @return The visitor's result.
+ */
+template <typename T, typename F>
+REFLECTOR_INLINE decltype(auto) visit_member(T& target, size_t index, F&& visitor)
+{
+    using sequence_t = std::make_index_sequence<reflection_t<std::remove_const_t<T>>::count>;
+    using dispatch_t = detail::dispatch_t<T, std::remove_reference_t<F>, sequence_t>;
+    return dispatch_t::table[index](target, visitor);
+}
+
+REFLECTOR_END_NAMESPACE
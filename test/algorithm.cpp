@@ -0,0 +1,68 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the member-wise batch algorithms.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <vector>
+#include <cstdint>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/algorithm.hpp>
+
+struct metric_t {
+    int32_t hits;
+    float ratio;
+    double total;
+};
+
+struct scaled_t {
+    int64_t hits;
+    double ratio;
+    double total;
+};
+
+/**
+ * Checks whether every member of every instance in a batch is visited.
+ * @since 1.0
+ */
+TEST_CASE("visiting members over a batch of instances", "[algorithm]")
+{
+    std::vector<metric_t> batch = {{1, 0.5f, 10.0}, {2, 0.25f, 20.0}, {3, 0.125f, 30.0}};
+
+    double sum = 0;
+    size_t visits = 0;
+
+    reflector::for_each_member(reflector::span_t(batch), [&](auto& member) {
+        sum += member; ++visits;
+    });
+
+    REQUIRE(visits == 9);
+    REQUIRE(sum == 66.875);
+
+    reflector::for_each_member(reflector::span_t(batch), [](auto& member) { member *= 2; });
+
+    REQUIRE(batch[0].hits == 2);
+    REQUIRE(batch[1].ratio == 0.5f);
+    REQUIRE(batch[2].total == 60.0);
+}
+
+/**
+ * Checks whether a batch can be transformed member-wise into another type.
+ * @since 1.0
+ */
+TEST_CASE("transforming members over a batch of instances", "[algorithm]")
+{
+    const std::vector<metric_t> source = {{1, 0.5f, 10.0}, {2, 0.25f, 20.0}};
+    std::vector<scaled_t> destination (source.size());
+
+    reflector::transform_members(
+        reflector::span_t(source)
+      , reflector::span_t(destination)
+      , [](const auto& member) { return member * 4; });
+
+    REQUIRE(destination[0].hits == 4);
+    REQUIRE(destination[0].ratio == 2.0);
+    REQUIRE(destination[1].total == 80.0);
+}
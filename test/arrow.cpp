@@ -0,0 +1,125 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the Arrow columnar export.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/arrow.hpp>
+
+struct order_t {
+    uint64_t id;
+    double price;
+    int32_t quantity;
+    int8_t flags[2];
+};
+
+struct tick_t {
+    int32_t symbol;
+    float price;
+};
+
+REFLECTOR_DECLARE(tick_t, &tick_t::symbol, &tick_t::price)
+
+/**
+ * Checks whether the schema of a reflected type is exported.
+ * @since 1.0
+ */
+TEST_CASE("exporting the Arrow schema of reflected types", "[arrow]")
+{
+    ArrowSchema schema;
+    reflector::export_schema<order_t>(&schema);
+
+    REQUIRE(std::strcmp(schema.format, "+s") == 0);
+    REQUIRE(schema.n_children == 5);
+    REQUIRE(std::strcmp(schema.children[0]->format, "L") == 0);
+    REQUIRE(std::strcmp(schema.children[1]->format, "g") == 0);
+    REQUIRE(std::strcmp(schema.children[2]->format, "i") == 0);
+    REQUIRE(std::strcmp(schema.children[4]->format, "c") == 0);
+    REQUIRE(std::strcmp(schema.children[3]->name, "f3") == 0);
+
+    schema.release(&schema);
+    REQUIRE(schema.release == nullptr);
+
+    reflector::export_schema<tick_t>(&schema);
+
+    REQUIRE(std::strcmp(schema.children[0]->name, "symbol") == 0);
+    REQUIRE(std::strcmp(schema.children[1]->name, "price") == 0);
+    REQUIRE(std::strcmp(schema.children[1]->format, "f") == 0);
+
+    schema.release(&schema);
+}
+
+/**
+ * Checks whether columns are exported without being copied.
+ * @since 1.0
+ */
+TEST_CASE("exporting columns as Arrow arrays", "[arrow]")
+{
+    reflector::soa_vector_t<order_t> soa;
+    soa.push_back({1, 9.5, 10, {1, 2}});
+    soa.push_back({2, 9.75, -5, {3, 4}});
+
+    const void *prices = soa.column<1>().data();
+
+    ArrowArray array;
+    reflector::export_array(std::move(soa), &array);
+
+    REQUIRE(array.length == 2);
+    REQUIRE(array.n_children == 5);
+    REQUIRE(array.n_buffers == 1);
+    REQUIRE(array.buffers[0] == nullptr);
+    REQUIRE(array.children[1]->buffers[1] == prices);
+    REQUIRE(array.children[1]->length == 2);
+    REQUIRE(array.children[2]->null_count == 0);
+    REQUIRE(static_cast<const int32_t*>(array.children[2]->buffers[1])[1] == -5);
+    REQUIRE(static_cast<const int8_t*>(array.children[4]->buffers[1])[0] == 2);
+
+    array.release(&array);
+    REQUIRE(array.release == nullptr);
+
+    std::vector<order_t> orders = {{3, 1.0, 1, {0, 0}}};
+    reflector::export_array(reflector::span_t<const order_t>(orders), &array);
+
+    REQUIRE(array.length == 1);
+    REQUIRE(static_cast<const uint64_t*>(array.children[0]->buffers[1])[0] == 3);
+
+    array.release(&array);
+}
+
+/**
+ * Checks whether children moved out of their parent outlive its release.
+ * @since 1.0
+ */
+TEST_CASE("releasing Arrow children moved out of their parent", "[arrow]")
+{
+    std::vector<order_t> orders = {{5, 2.5, 7, {1, 1}}, {6, 3.5, 8, {2, 2}}};
+
+    ArrowArray array, child;
+    reflector::export_array(reflector::span_t<const order_t>(orders), &array);
+
+    child = *array.children[2];
+    array.children[2]->release = nullptr;
+    array.release(&array);
+
+    REQUIRE(child.release != nullptr);
+    REQUIRE(static_cast<const int32_t*>(child.buffers[1])[1] == 8);
+
+    child.release(&child);
+    REQUIRE(child.release == nullptr);
+
+    ArrowSchema schema, field;
+    reflector::export_schema<tick_t>(&schema);
+
+    field = *schema.children[1];
+    schema.children[1]->release = nullptr;
+    schema.release(&schema);
+
+    REQUIRE(std::strcmp(field.name, "price") == 0);
+    field.release(&field);
+}
@@ -0,0 +1,65 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the atomic member access view.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <atomic>
+#include <cstdint>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/atomic.hpp>
+
+struct metrics_t {
+    uint64_t requests;
+    uint32_t errors;
+    double latency;
+    int16_t status[2];
+};
+
+/**
+ * Checks whether members of a shared instance are atomically accessed in place.
+ * @since 1.0
+ */
+TEST_CASE("atomically accessing members in place", "[atomic]")
+{
+    metrics_t metrics {10, 1, 0.5, {200, 404}};
+    auto view = reflector::atomic_view_t(metrics);
+
+    static_assert(decltype(view)::count == 5);
+
+    REQUIRE(view.load<0>() == 10);
+    REQUIRE(view.fetch_add<0>(5, std::memory_order_relaxed) == 10);
+    REQUIRE(view.exchange<1>(7) == 1);
+
+    view.store<2>(1.25, std::memory_order_release);
+    view.store<4>(500);
+
+    REQUIRE(metrics.requests == 15);
+    REQUIRE(metrics.errors == 7);
+    REQUIRE(view.load<2>(std::memory_order_acquire) == 1.25);
+    REQUIRE(metrics.status[1] == 500);
+}
+
+/**
+ * Checks whether all members of a shared instance are loaded and stored at once.
+ * @since 1.0
+ */
+TEST_CASE("atomically loading and storing all members", "[atomic]")
+{
+    metrics_t metrics {};
+    auto view = reflector::atomic_view_t(metrics);
+
+    view.store_all({3, 2, 0.75, {1, -1}}, std::memory_order_release);
+    auto copy = view.load_all(std::memory_order_acquire);
+
+    REQUIRE(copy.requests == 3);
+    REQUIRE(copy.errors == 2);
+    REQUIRE(copy.latency == 0.75);
+    REQUIRE(copy.status[0] == 1);
+    REQUIRE(copy.status[1] == -1);
+
+    REQUIRE(view.load_all(std::memory_order_relaxed).requests == 3);
+    REQUIRE(view.load_all().latency == 0.75);
+}
@@ -0,0 +1,115 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the struct-of-arrays staging into device memory.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <vector>
+#include <cstdint>
+#include <cstring>
+
+#include <catch.hpp>
+#include <cuda_runtime.h>
+#include <reflector.h>
+#include <reflector/cuda.hpp>
+
+struct particle_t {
+    uint8_t kind;
+    double mass;
+    uint16_t charge;
+    float position[2];
+};
+
+/**
+ * Checks whether a device column matches the bytes of a member in each instance.
+ * @tparam N The index of the member column to be checked.
+ * @param columns The handle to the device columns.
+ * @param source The instances uploaded into device memory.
+ * @return Does the device column match the instances' members?
+ */
+template <size_t N>
+static bool matches(
+    const reflector::device_columns_t<particle_t>& columns
+  , const std::vector<particle_t>& source
+) {
+    using descriptor_t = reflector::reflection_t<particle_t>::descriptor_t;
+    using element_t = reflector::device_columns_t<particle_t>::element_t<N>;
+    constexpr size_t offset = descriptor_t::offset_v<N>;
+
+    auto column = columns.column<N>();
+
+    for (size_t i = 0; i < source.size(); ++i) {
+        const auto *member = reinterpret_cast<const uint8_t*>(&source[i]) + offset;
+        if (column.size() != source.size() || std::memcmp(&column[i], member, sizeof(element_t)) != 0)
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Checks whether instances of a padded type are staged into device columns laid out
+ * by the type's member offsets, and whether they are copied back.
+ * @since 1.0
+ */
+TEST_CASE("device staging transposes padded instances into columns", "[cuda]")
+{
+    using descriptor_t = reflector::reflection_t<particle_t>::descriptor_t;
+    static_assert(descriptor_t::offset_v<1> > descriptor_t::offset_v<0> + 1);
+
+    auto source = std::vector<particle_t>();
+
+    for (uint8_t i = 0; i < 37; ++i)
+        source.push_back({i, 1.5 * i, uint16_t(1000 + i), {0.5f * i, -0.5f * i}});
+
+    {
+        reflector::device_soa_t<particle_t> device;
+
+        REQUIRE(device.upload(reflector::span_t<const particle_t>(source.data(), source.size())) == cudaSuccess);
+        REQUIRE(device.size() == source.size());
+        REQUIRE(cuda_stub::allocations == descriptor_t::count);
+
+        const auto& columns = device.columns();
+
+        REQUIRE(matches<0>(columns, source));
+        REQUIRE(matches<1>(columns, source));
+        REQUIRE(matches<2>(columns, source));
+        REQUIRE(matches<3>(columns, source));
+        REQUIRE(matches<4>(columns, source));
+        REQUIRE(columns.get<2>(36) == 1036);
+
+        columns.get<1>(3) = 42.0;
+
+        auto target = std::vector<particle_t>(source.size());
+        REQUIRE(device.download(reflector::span_t<particle_t>(target.data(), target.size())) == cudaSuccess);
+
+        for (size_t i = 0; i < source.size(); ++i) {
+            REQUIRE(target[i].kind == source[i].kind);
+            REQUIRE(target[i].mass == (i == 3 ? 42.0 : source[i].mass));
+            REQUIRE(target[i].charge == source[i].charge);
+            REQUIRE(target[i].position[0] == source[i].position[0]);
+            REQUIRE(target[i].position[1] == source[i].position[1]);
+        }
+    }
+
+    REQUIRE(cuda_stub::allocations == 0);
+}
+
+/**
+ * Checks whether a failed device allocation releases the columns already allocated.
+ * @since 1.0
+ */
+TEST_CASE("device staging releases memory on allocation failure", "[cuda]")
+{
+    auto source = std::vector<particle_t>(8);
+    reflector::device_soa_t<particle_t> device;
+
+    cuda_stub::failing = 3;
+
+    REQUIRE(device.upload(reflector::span_t<const particle_t>(source.data(), source.size())) == cudaErrorMemoryAllocation);
+    REQUIRE(device.size() == 0);
+    REQUIRE(cuda_stub::allocations == 0);
+
+    REQUIRE(device.upload(reflector::span_t<const particle_t>(source.data(), source.size())) == cudaSuccess);
+    REQUIRE(device.size() == source.size());
+}
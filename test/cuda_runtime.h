@@ -0,0 +1,59 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file A host-only stub of the CUDA runtime, for testing device memory staging.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+
+/*
+ * The CUDA runtime is stubbed so that device memory staging can be tested on hosts
+ * without a CUDA device. Device memory is allocated from the host heap, and thus can
+ * be directly inspected by tests. The number of live allocations is tracked, and an
+ * allocation can be made to fail, so that the release of device memory is tested.
+ */
+enum cudaError_t
+{
+    cudaSuccess = 0
+  , cudaErrorMemoryAllocation = 2
+};
+
+enum cudaMemcpyKind
+{
+    cudaMemcpyHostToHost = 0
+  , cudaMemcpyHostToDevice = 1
+  , cudaMemcpyDeviceToHost = 2
+  , cudaMemcpyDeviceToDevice = 3
+};
+
+namespace cuda_stub
+{
+    inline size_t allocations = 0;
+    inline size_t failing = 0;
+}
+
+inline cudaError_t cudaMalloc(void **pointer, size_t bytes)
+{
+    if (cuda_stub::failing > 0 && --cuda_stub::failing == 0)
+        return cudaErrorMemoryAllocation;
+
+    *pointer = std::malloc(bytes > 0 ? bytes : 1);
+    return *pointer != nullptr ? (++cuda_stub::allocations, cudaSuccess) : cudaErrorMemoryAllocation;
+}
+
+inline cudaError_t cudaFree(void *pointer)
+{
+    if (pointer != nullptr) --cuda_stub::allocations;
+    std::free(pointer);
+    return cudaSuccess;
+}
+
+inline cudaError_t cudaMemcpy(void *target, const void *source, size_t bytes, cudaMemcpyKind)
+{
+    if (bytes > 0) std::memcpy(target, source, bytes);
+    return cudaSuccess;
+}
@@ -0,0 +1,92 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the member-wise difference and partial copy.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/delta.hpp>
+
+struct state_t {
+    uint8_t mode;
+    int32_t position[3];
+    double speed;
+    uint16_t flags;
+};
+
+/**
+ * Checks whether the members differing between two instances are found.
+ * @since 1.0
+ */
+TEST_CASE("finding members which differ between instances", "[delta]")
+{
+    auto a = state_t {1, {10, 20, 30}, 1.5, 7};
+    auto b = a;
+
+    REQUIRE(reflector::diff(a, b).none());
+
+    b.position[1] = 21;
+    b.flags = 8;
+
+    auto mask = reflector::diff(a, b);
+
+    REQUIRE(mask.size() == 6);
+    REQUIRE(mask.count() == 2);
+    REQUIRE(mask.test(2));
+    REQUIRE(mask.test(5));
+}
+
+/**
+ * Checks whether only the masked members are copied between instances.
+ * @since 1.0
+ */
+TEST_CASE("copying masked members between instances", "[delta]")
+{
+    auto source = state_t {2, {1, 2, 3}, 9.5, 4};
+    auto target = state_t {0, {0, 0, 0}, 0.0, 0};
+
+    reflector::member_mask_t<state_t> mask;
+    mask.set(1).set(2).set(3).set(4);
+
+    reflector::apply(target, source, mask);
+
+    REQUIRE(target.mode == 0);
+    REQUIRE(target.position[0] == 1);
+    REQUIRE(target.position[2] == 3);
+    REQUIRE(target.speed == 9.5);
+    REQUIRE(target.flags == 0);
+
+    reflector::apply(target, source, reflector::diff(target, source));
+    REQUIRE(reflector::diff(target, source).none());
+}
+
+/**
+ * Checks whether padding bytes within nested members are skipped when comparing.
+ * @since 1.0
+ */
+TEST_CASE("finding differences between nested members with padding", "[delta]")
+{
+    struct inner_t { uint8_t tag; uint32_t value; };
+    struct outer_t { uint16_t id; inner_t inner; uint8_t level; };
+
+    outer_t a, b;
+    std::memset(&a, 0x00, sizeof(outer_t));
+    std::memset(&b, 0xff, sizeof(outer_t));
+
+    a.id = b.id = 3;
+    a.inner.tag = b.inner.tag = 1;
+    a.inner.value = b.inner.value = 42;
+    a.level = b.level = 9;
+
+    REQUIRE(reflector::diff(a, b).none());
+
+    b.inner.value = 43;
+    auto mask = reflector::diff(a, b);
+
+    REQUIRE(mask.count() == 1);
+    REQUIRE(mask.test(1));
+}
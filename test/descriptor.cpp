@@ -0,0 +1,93 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the reflected types' layout descriptor.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <catch.hpp>
+#include <reflector.h>
+
+struct padded_t {
+    char a;
+    double b;
+    int16_t c[3];
+    int32_t d;
+};
+
+/**
+ * Checks whether the layout table computed by the descriptor agrees with the layout
+ * produced by the compiler for the reflected type.
+ * @since 1.0
+ */
+TEST_CASE("descriptor layout table matches the compiler's layout", "[descriptor]")
+{
+    using reflection_t = reflector::reflection_t<padded_t>;
+
+    static_assert(reflection_t::offset<0>() == offsetof(padded_t, a));
+    static_assert(reflection_t::offset<1>() == offsetof(padded_t, b));
+    static_assert(reflection_t::offset<2>() == offsetof(padded_t, c));
+    static_assert(reflection_t::offset<3>() == offsetof(padded_t, c) + sizeof(int16_t));
+    static_assert(reflection_t::offset<4>() == offsetof(padded_t, c) + sizeof(int16_t) * 2);
+    static_assert(reflection_t::offset<5>() == offsetof(padded_t, d));
+
+    auto target = padded_t {'x', 2.5, {1, 2, 3}, 42};
+
+    REQUIRE(reflection_t::member<0>(target) == 'x');
+    REQUIRE(reflection_t::member<1>(target) == 2.5);
+    REQUIRE(reflection_t::member<4>(target) == 3);
+    REQUIRE(reflection_t::member<5>(target) == 42);
+
+    reflection_t::member<3>(target) = 20;
+    REQUIRE(target.c[1] == 20);
+}
+
+/**
+ * Checks whether types with homogeneous members are viewed as contiguous arrays.
+ * @since 1.0
+ */
+TEST_CASE("viewing homogeneous members as a contiguous array", "[descriptor]")
+{
+    struct vector3_t { float x, y, z; };
+    struct matrix_t { double m[2][2]; };
+    struct mixed_t { float x; int y; };
+
+    static_assert(reflector::reflection_t<vector3_t>::descriptor_t::is_homogeneous);
+    static_assert(reflector::reflection_t<matrix_t>::descriptor_t::is_homogeneous);
+    static_assert(!reflector::reflection_t<mixed_t>::descriptor_t::is_homogeneous);
+
+    vector3_t vector {1.f, 2.f, 3.f};
+    float sum = 0.f;
+
+    for (float& value : reflector::reflection_t<vector3_t>::as_span(vector))
+        sum += value *= 2.f;
+
+    REQUIRE(sum == 12.f);
+    REQUIRE(vector.z == 6.f);
+
+    const matrix_t matrix {{{1, 2}, {3, 4}}};
+    auto values = reflector::reflection_t<matrix_t>::as_span(matrix);
+
+    REQUIRE(values.size() == 4);
+    REQUIRE(values[2] == 3);
+}
+
+#if defined(__cpp_lib_bit_cast) && defined(__cpp_lib_is_constant_evaluated)
+/**
+ * Checks whether automatically reflected members are read within constant expressions.
+ * @since 1.0
+ */
+TEST_CASE("reading automatically reflected members at compile-time", "[descriptor]")
+{
+    struct config_t { int32_t retries; double backoff; uint8_t flags[2]; };
+    constexpr auto config = config_t {3, 1.5, {4, 5}};
+
+    static_assert(reflector::reflection_t<config_t>::value<0>(config) == 3);
+    static_assert(reflector::reflection_t<config_t>::value<1>(config) == 1.5);
+    static_assert(reflector::reflection_t<config_t>::value<3>(config) == 5);
+
+    REQUIRE(reflector::reflection_t<config_t>::value<2>(config) == 4);
+}
+#endif
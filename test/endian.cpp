@@ -0,0 +1,84 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the byte order conversion.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/endian.hpp>
+
+struct coordinate_t {
+    int16_t lat, lon;
+};
+
+struct packet_t {
+    uint32_t sequence;
+    char tag;
+    coordinate_t position;
+    double value;
+};
+
+struct words_t {
+    uint32_t a;
+    int32_t b[3];
+};
+
+/**
+ * Checks whether every arithmetic leaf member has its byte order converted.
+ * @since 1.0
+ */
+TEST_CASE("converting instances to and from big-endian", "[endian]")
+{
+    static_assert(reflector::detail::uniform_width_v<packet_t> == 0);
+    static_assert(reflector::detail::uniform_width_v<words_t> == 4);
+
+    packet_t packet {0x01020304, 'z', {0x0102, -2}, 1.5};
+    reflector::to_big_endian(packet);
+
+    if constexpr (!reflector::is_big_endian_v) {
+        REQUIRE(packet.sequence == 0x04030201);
+        REQUIRE(packet.tag == 'z');
+        REQUIRE(packet.position.lat == 0x0201);
+        REQUIRE(packet.position.lon == int16_t(0xfeff));
+    }
+
+    const uint8_t *bytes = reinterpret_cast<const uint8_t*>(&packet.sequence);
+    REQUIRE(bytes[0] == 0x01);
+    REQUIRE(bytes[3] == 0x04);
+
+    reflector::from_big_endian(packet);
+
+    REQUIRE(packet.sequence == 0x01020304);
+    REQUIRE(packet.position.lon == -2);
+    REQUIRE(packet.value == 1.5);
+}
+
+/**
+ * Checks whether batches of instances have their byte order converted.
+ * @since 1.0
+ */
+TEST_CASE("converting batches to and from big-endian", "[endian]")
+{
+    std::vector<packet_t> packets (33, packet_t {0xAABBCCDD, 'q', {1, 2}, -3.25});
+    std::vector<words_t> words (17, words_t {0x11223344, {1, 2, 3}});
+
+    reflector::to_big_endian(reflector::span_t(packets));
+    reflector::to_big_endian(reflector::span_t(words));
+
+    REQUIRE(reinterpret_cast<const uint8_t*>(&packets[32].sequence)[0] == 0xAA);
+    REQUIRE(reinterpret_cast<const uint8_t*>(&words[16].b[2])[3] == 0x03);
+
+    reflector::from_big_endian(reflector::span_t(packets));
+    reflector::from_big_endian(reflector::span_t(words));
+
+    REQUIRE(packets[20].sequence == 0xAABBCCDD);
+    REQUIRE(packets[20].position.lon == 2);
+    REQUIRE(packets[32].value == -3.25);
+    REQUIRE(words[16].a == 0x11223344);
+    REQUIRE(words[9].b[1] == 2);
+}
@@ -0,0 +1,65 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the recursive flattening reflection.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/flat.hpp>
+
+struct vector_t {
+    float x, y, z;
+};
+
+struct body_t {
+    vector_t position;
+    char tag;
+    vector_t velocities[2];
+    double mass;
+};
+
+struct world_t {
+    int16_t id;
+    body_t body;
+};
+
+/**
+ * Checks whether nested aggregates are flattened into their leaf members.
+ * @since 1.0
+ */
+TEST_CASE("flattening nested aggregates into leaves", "[flat]")
+{
+    using flat_t = reflector::flat_reflection_t<world_t>;
+    using descriptor_t = flat_t::descriptor_t;
+
+    static_assert(flat_t::count == 12);
+    static_assert(std::is_same_v<flat_t::reflection_tuple_t::element_t<0>, int16_t>);
+    static_assert(std::is_same_v<flat_t::reflection_tuple_t::element_t<4>, char>);
+    static_assert(std::is_same_v<flat_t::reflection_tuple_t::element_t<11>, double>);
+
+    static_assert(flat_t::offset<1>()  == offsetof(world_t, body) + offsetof(body_t, position));
+    static_assert(flat_t::offset<4>()  == offsetof(world_t, body) + offsetof(body_t, tag));
+    static_assert(flat_t::offset<8>()  == offsetof(world_t, body) + offsetof(body_t, velocities) + sizeof(vector_t));
+    static_assert(flat_t::offset<11>() == offsetof(world_t, body) + offsetof(body_t, mass));
+
+    static_assert(descriptor_t::packed_size == sizeof(int16_t) + 9 * sizeof(float) + 1 + sizeof(double));
+    static_assert(descriptor_t::has_padding);
+
+    world_t world {};
+    auto flat = flat_t(world);
+
+    flat.get<0>()  = 7;
+    flat.get<2>()  = 1.5f;
+    flat.get<10>() = -2.f;
+    flat_t::member<11>(world) = 80.0;
+
+    REQUIRE(world.id == 7);
+    REQUIRE(world.body.position.y == 1.5f);
+    REQUIRE(world.body.velocities[1].z == -2.f);
+    REQUIRE(world.body.mass == 80.0);
+}
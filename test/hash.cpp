@@ -0,0 +1,55 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the reflection-based hashing and equality.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <unordered_map>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/hash.hpp>
+
+struct identifier_t {
+    int32_t region;
+    int32_t id;
+};
+
+struct composite_t {
+    identifier_t key;
+    uint8_t kind;
+    double weight;
+};
+
+/**
+ * Checks whether reflected types can be used as hash map keys.
+ * @since 1.0
+ */
+TEST_CASE("hashing and comparing reflected types", "[hash]")
+{
+    using map_t = std::unordered_map<
+        composite_t, int, reflector::hash_t<composite_t>, reflector::equal_to_t<composite_t>>;
+
+    static_assert(reflector::detail::bytewise_v<identifier_t>);
+    static_assert(!reflector::detail::bytewise_v<composite_t>);
+
+    auto hash = reflector::hash_t<identifier_t>();
+    auto equal = reflector::equal_to_t<identifier_t>();
+
+    REQUIRE(hash({1, 2}) == hash({1, 2}));
+    REQUIRE(equal({1, 2}, {1, 2}));
+    REQUIRE(!equal({1, 2}, {2, 1}));
+
+    map_t map;
+    map[{{1, 2}, 3, 0.5}] = 10;
+    map[{{1, 2}, 4, 0.5}] = 20;
+
+    REQUIRE(map.size() == 2);
+    REQUIRE(map.at({{1, 2}, 3, 0.5}) == 10);
+    REQUIRE(map.count({{1, 2}, 3, -0.5}) == 0);
+
+    REQUIRE(reflector::equal_to_t<composite_t>()({{1, 1}, 0, 0.0}, {{1, 1}, 0, -0.0}));
+    REQUIRE(reflector::hash_t<composite_t>()({{1, 1}, 0, 0.0})
+        ==  reflector::hash_t<composite_t>()({{1, 1}, 0, -0.0}));
+}
@@ -0,0 +1,64 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the memory layout analyzer.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <array>
+#include <cstdint>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/layout.hpp>
+
+struct sparse_t {
+    uint8_t a;
+    uint64_t b;
+    uint16_t c[2];
+    uint32_t d;
+    uint8_t e;
+};
+
+struct blob_t {
+    uint8_t bytes[16];
+};
+
+struct straddling_t {
+    uint8_t head[56];
+    blob_t blob;
+};
+
+/**
+ * Checks whether the padding of a type is correctly reported.
+ * @since 1.0
+ */
+TEST_CASE("reporting padding holes of a type", "[layout]")
+{
+    using info_t = reflector::layout_info_t<sparse_t>;
+
+    static_assert(info_t::size == 32);
+    static_assert(info_t::padding == 14);
+    static_assert(info_t::holes.size() == 2);
+    static_assert(info_t::holes[0].offset == 1 && info_t::holes[0].size == 7);
+    static_assert(info_t::holes[1].offset == 25 && info_t::holes[1].size == 7);
+    static_assert(info_t::straddling.size() == 0);
+
+    REQUIRE(info_t::holes[0].size + info_t::holes[1].size == info_t::padding);
+}
+
+/**
+ * Checks whether a members' reordering minimizing the type's size is suggested.
+ * @since 1.0
+ */
+TEST_CASE("suggesting a packed order for members", "[layout]")
+{
+    using info_t = reflector::layout_info_t<sparse_t>;
+
+    constexpr auto expected = std::array<size_t, 6> {1, 4, 2, 3, 0, 5};
+
+    static_assert(info_t::packed_size == 24);
+    static_assert(reflector::layout_info_t<straddling_t>::straddling.size() == 1);
+    static_assert(reflector::layout_info_t<straddling_t>::straddling[0] == 56);
+
+    REQUIRE(reflector::packed_order_v<sparse_t> == expected);
+}
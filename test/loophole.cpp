@@ -4,6 +4,9 @@
  * @author Rodrigo Siqueira <rodriados@gmail.com>
  * @copyright 2024-present Rodrigo Siqueira
  */
+#include <cstddef>
+#include <cstdint>
+
 #include <catch.hpp>
 #include <reflector.h>
 #include <supertuple.h>
@@ -61,3 +64,30 @@ TEST_CASE("general use-case for the loophole mechanism", "[loophole]")
     REQUIRE(cilinder.surface.radius == 100);
     REQUIRE(cilinder.height == -9.7);
 }
+
+struct wide_t {
+    int32_t header;
+    uint8_t payload[100];
+    double trailer[3];
+};
+
+/**
+ * Checks whether members are correctly counted for types with large array members.
+ * @since 1.0
+ */
+TEST_CASE("counting members of types with large arrays", "[loophole]")
+{
+    using reflection_t = reflector::reflection_t<wide_t>;
+
+    static_assert(reflector::detail::count<point_t<int>>() == 2);
+    static_assert(reflector::detail::count<wide_t>() == 104);
+    static_assert(reflection_t::count == 104);
+    static_assert(reflection_t::offset<101>() == offsetof(wide_t, trailer));
+
+    auto wide = wide_t {};
+    wide.payload[99] = 7;
+    wide.trailer[2] = 1.5;
+
+    REQUIRE(reflection_t::member<100>(wide) == 7);
+    REQUIRE(reflection_t::member<103>(wide) == 1.5);
+}
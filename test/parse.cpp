@@ -0,0 +1,164 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the columnar text parser.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/parse.hpp>
+
+namespace
+{
+    struct record_t {
+        int32_t id;
+        double price;
+        char grade;
+        uint8_t active;
+        uint16_t levels[2];
+    };
+
+    struct flag_t {
+        int32_t id;
+        bool enabled;
+    };
+}
+
+/**
+ * Checks whether delimited rows are parsed into the container's columns.
+ * @since 1.0
+ */
+TEST_CASE("parsing delimited rows into columns", "[parse]")
+{
+    reflector::soa_vector_t<record_t> soa;
+
+    auto result = reflector::parse_rows<record_t>(
+        "1,2.5,a,1,10,20\n"
+        "\n"
+        "-7,0.125,b,0,30,40\r\n"
+        "3;1e3;c;1;50;60"
+      , soa
+    );
+
+    REQUIRE(!result);
+    REQUIRE(result.status == reflector::parse_status_t::invalid_field);
+    REQUIRE(result.rows == 2);
+    REQUIRE(result.field == 0);
+    REQUIRE(soa.size() == 2);
+
+    REQUIRE(soa.column<0>()[1] == -7);
+    REQUIRE(soa.column<1>()[0] == 2.5);
+    REQUIRE(soa.column<1>()[1] == 0.125);
+    REQUIRE(soa.column<2>()[1] == 'b');
+    REQUIRE(soa.column<3>()[0] == 1);
+    REQUIRE(soa.column<3>()[1] == 0);
+    REQUIRE(soa.column<4>()[1] == 30);
+    REQUIRE(soa.column<5>()[1] == 40);
+
+    result = reflector::parse_rows<record_t>("3;1e3;c;1;50;60\n", soa, ';');
+
+    REQUIRE(result);
+    REQUIRE(result.consumed == 16);
+    REQUIRE(soa.size() == 3);
+    REQUIRE(soa.column<1>()[2] == 1000.0);
+}
+
+/**
+ * Checks whether rows ended by a lone carriage-return are split.
+ * @since 1.0
+ */
+TEST_CASE("parsing rows with carriage-return line endings", "[parse]")
+{
+    reflector::soa_vector_t<record_t> soa;
+
+    auto result = reflector::parse_rows<record_t>(
+        "1,2.5,a,1,10,20\r"
+        "\r"
+        "2,0.5,b,0,30,40\r\n"
+        "3,1.5,c,1,50,60\r"
+      , soa
+    );
+
+    REQUIRE(result);
+    REQUIRE(result.rows == 3);
+    REQUIRE(result.consumed == 50);
+    REQUIRE(soa.size() == 3);
+    REQUIRE(soa.column<0>()[1] == 2);
+    REQUIRE(soa.column<2>()[2] == 'c');
+    REQUIRE(soa.column<5>()[0] == 20);
+}
+
+/**
+ * Checks whether malformed rows are reported and left out of the container.
+ * @since 1.0
+ */
+TEST_CASE("parsing malformed delimited rows", "[parse]")
+{
+    reflector::soa_vector_t<record_t> soa;
+
+    auto missing = reflector::parse_rows<record_t>("1,2.5,a,1,10\n", soa);
+    REQUIRE(missing.status == reflector::parse_status_t::missing_field);
+    REQUIRE(missing.field == 5);
+
+    auto excess = reflector::parse_rows<record_t>("1,2.5,a,1,10,20,30\n", soa);
+    REQUIRE(excess.status == reflector::parse_status_t::excess_field);
+
+    auto overflow = reflector::parse_rows<record_t>("1,2.5,a,1,10,70000\n", soa);
+    REQUIRE(overflow.status == reflector::parse_status_t::invalid_field);
+    REQUIRE(overflow.consumed == 0);
+
+    REQUIRE(soa.empty());
+}
+
+/**
+ * Checks whether fixed-width rows are parsed into the container's columns.
+ * @since 1.0
+ */
+TEST_CASE("parsing fixed-width rows into columns", "[parse]")
+{
+    reflector::soa_vector_t<record_t> soa;
+
+    auto result = reflector::parse_rows<record_t>(
+        "   12  3.75x1   5   6\n"
+        "  -40     8y0 700 800\n"
+      , soa
+      , {5, 6, 1, 1, 4, 4}
+    );
+
+    REQUIRE(result);
+    REQUIRE(result.rows == 2);
+    REQUIRE(soa.column<0>()[0] == 12);
+    REQUIRE(soa.column<0>()[1] == -40);
+    REQUIRE(soa.column<1>()[0] == 3.75);
+    REQUIRE(soa.column<2>()[1] == 'y');
+    REQUIRE(soa.column<3>()[1] == 0);
+    REQUIRE(soa.column<5>()[1] == 800);
+}
+
+/**
+ * Checks whether boolean members are parsed from both numeric and textual forms.
+ * @since 1.0
+ */
+TEST_CASE("parsing boolean fields", "[parse]")
+{
+    reflector::soa_vector_t<flag_t> soa;
+
+    auto result = reflector::parse_rows<flag_t>("1,true\n2,0\n3,false\n4,1\n", soa);
+
+    REQUIRE(result);
+    REQUIRE(soa.size() == 4);
+    REQUIRE(soa.column<1>()[0] == true);
+    REQUIRE(soa.column<1>()[1] == false);
+    REQUIRE(soa.column<1>()[2] == false);
+    REQUIRE(soa.column<1>()[3] == true);
+
+    auto invalid = reflector::parse_rows<flag_t>("5,yes\n", soa);
+    REQUIRE(invalid.status == reflector::parse_status_t::invalid_field);
+    REQUIRE(invalid.field == 1);
+
+    auto numeric = reflector::parse_rows<flag_t>("6,2\n", soa);
+    REQUIRE(numeric.status == reflector::parse_status_t::invalid_field);
+    REQUIRE(soa.size() == 4);
+}
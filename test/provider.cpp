@@ -0,0 +1,116 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the manually-provided reflection mechanism.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/names.hpp>
+
+struct message_t {
+    uint16_t kind;
+    uint32_t sequence;
+    char payload[4];
+    double timestamp;
+};
+
+REFLECTOR_DECLARE(message_t
+  , &message_t::kind
+  , &message_t::sequence
+  , &message_t::payload
+  , &message_t::timestamp)
+
+struct int_pair_t {
+    int first, second;
+};
+
+/**
+ * Checks whether a type declared with an explicit members' list is reflected.
+ * @since 1.0
+ */
+TEST_CASE("reflecting types with explicitly declared members", "[provider]")
+{
+    using reflection_t = reflector::reflection_t<message_t>;
+
+    static_assert(reflection_t::count == 7);
+    static_assert(reflection_t::offset<1>() == offsetof(message_t, sequence));
+    static_assert(reflection_t::offset<3>() == offsetof(message_t, payload) + 1);
+    static_assert(reflection_t::offset<6>() == offsetof(message_t, timestamp));
+
+    auto message = message_t {1, 2, {'a', 'b', 'c', 'd'}, 3.5};
+    auto [kind, sequence, p0, p1, p2, p3, timestamp] = reflection_t(message);
+
+    REQUIRE(kind == 1);
+    REQUIRE(sequence == 2);
+    REQUIRE(p2 == 'c');
+    REQUIRE(timestamp == 3.5);
+
+    p3 = 'z';
+    REQUIRE(message.payload[3] == 'z');
+}
+
+/**
+ * Checks whether explicitly declared members are accessed within constant expressions.
+ * @since 1.0
+ */
+TEST_CASE("accessing explicitly declared members at compile-time", "[provider]")
+{
+    using reflection_t = reflector::reflection_t<message_t>;
+    constexpr auto message = message_t {7, 42, {'w', 'x', 'y', 'z'}, 0.25};
+
+    static_assert(reflection_t::member<0>(message) == 7);
+    static_assert(reflection_t::member<1>(message) == 42);
+    static_assert(reflection_t::member<4>(message) == 'y');
+    static_assert(reflection_t::value<6>(message) == 0.25);
+
+    auto copy = message;
+    reflection_t::member<5>(copy) = 'a';
+
+    REQUIRE(copy.payload[3] == 'a');
+}
+
+/**
+ * Checks whether the member names of a declared type are recorded.
+ * @since 1.0
+ */
+TEST_CASE("retrieving names of explicitly declared members", "[provider]")
+{
+    static_assert(reflector::has_member_names_v<message_t>);
+    static_assert(!reflector::has_member_names_v<int_pair_t>);
+
+    static_assert(reflector::member_name<message_t>(0) == "kind");
+    static_assert(reflector::member_name<message_t>(1) == "sequence");
+    static_assert(reflector::member_name<message_t>(4) == "payload");
+    static_assert(reflector::member_name<message_t>(6) == "timestamp");
+    static_assert(reflector::member_name<message_t>(7).empty());
+
+    static_assert(reflector::member_index<message_t>("sequence") == 1);
+    static_assert(reflector::member_index<message_t>("payload") == 2);
+    static_assert(reflector::member_index<message_t>("timestamp") == 6);
+
+    REQUIRE(reflector::member_index<message_t>("kind") == 0);
+    REQUIRE(reflector::member_index<message_t>("unknown") == reflector::npos);
+    REQUIRE(reflector::member_index<message_t>("") == reflector::npos);
+    REQUIRE(reflector::member_name<message_t>(reflector::npos).empty());
+}
+
+/**
+ * Checks whether the perfect hash of member names rejects duplicate names.
+ * @since 1.0
+ */
+TEST_CASE("hashing duplicate member names", "[provider]")
+{
+    constexpr std::string_view unique = "kind, sequence, payload";
+    constexpr std::string_view duplicate = "kind, sequence, kind";
+
+    constexpr auto valid = reflector::detail::build_hash(unique, reflector::detail::split_names<3>(unique));
+    constexpr auto invalid = reflector::detail::build_hash(duplicate, reflector::detail::split_names<3>(duplicate));
+
+    static_assert(valid.valid);
+    static_assert(!invalid.valid);
+}
@@ -0,0 +1,100 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the parallel member-wise reductions.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <supertuple.h>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/reduce.hpp>
+
+namespace
+{
+    struct metric_t {
+        int32_t delta;
+        const char *label;
+        uint16_t hits;
+        double latency;
+    };
+
+    /**
+     * Checks the aggregates of a batch of metrics against a serial computation.
+     * @param result The aggregates to be checked.
+     * @param batch The batch of metrics which has been reduced.
+     */
+    void check_aggregates(const reflector::aggregates_t<metric_t>& result, reflector::span_t<const metric_t> batch)
+    {
+        const auto& delta = supertuple::get<0>(result);
+        const auto& hits = supertuple::get<2>(result);
+        const auto& latency = supertuple::get<3>(result);
+
+        int64_t dsum = 0; uint64_t hsum = 0; double lsum = 0;
+        int32_t dmin = batch[0].delta, dmax = batch[0].delta;
+        uint16_t hmin = batch[0].hits, hmax = batch[0].hits;
+
+        for (const auto& metric : batch) {
+            dsum += metric.delta; hsum += metric.hits; lsum += metric.latency;
+            dmin = std::min(dmin, metric.delta); dmax = std::max(dmax, metric.delta);
+            hmin = std::min(hmin, metric.hits); hmax = std::max(hmax, metric.hits);
+        }
+
+        REQUIRE(delta.count == batch.size());
+        REQUIRE(delta.sum == dsum);
+        REQUIRE(delta.min == dmin);
+        REQUIRE(delta.max == dmax);
+
+        REQUIRE(hits.count == batch.size());
+        REQUIRE(hits.sum == hsum);
+        REQUIRE(hits.min == hmin);
+        REQUIRE(hits.max == hmax);
+
+        REQUIRE(latency.count == batch.size());
+        REQUIRE(latency.sum == lsum);
+        REQUIRE(latency.min == 0.25);
+        REQUIRE(latency.max == 0.25);
+    }
+}
+
+/**
+ * Checks whether the arithmetic members of a batch are correctly reduced.
+ * @since 1.0
+ */
+TEST_CASE("reducing the members of a batch", "[reduce]")
+{
+    static_assert(std::is_empty_v<reflector::aggregate_t<const char*>>);
+    static_assert(std::is_same_v<decltype(reflector::aggregate_t<uint16_t>::sum), uint64_t>);
+    static_assert(std::is_same_v<decltype(reflector::aggregate_t<float>::sum), double>);
+    static_assert(alignof(reflector::detail::partial_t<metric_t>) == REFLECTOR_CACHE_LINE_SIZE);
+
+    std::vector<metric_t> metrics (10000);
+
+    for (size_t i = 0; i < metrics.size(); ++i)
+        metrics[i] = metric_t {int32_t(i * 37 % 1001) - 500, "metric", uint16_t(i * 7919 % 65521), 0.25};
+
+    const auto batch = reflector::span_t<const metric_t>(metrics.data(), metrics.size());
+
+    SECTION("reducing on the calling thread") {
+        check_aggregates(reflector::reduce_fields<metric_t>(batch), batch);
+    }
+
+    SECTION("reducing on multiple threads") {
+        auto executor = reflector::thread_executor_t(4);
+        check_aggregates(reflector::reduce_fields<metric_t>(batch, executor, 1000), batch);
+    }
+
+    SECTION("reducing with more jobs than instances") {
+        auto executor = reflector::thread_executor_t(8);
+        check_aggregates(reflector::reduce_fields<metric_t>(batch.subspan(0, 3), executor, 1), batch.subspan(0, 3));
+    }
+
+    SECTION("reducing an empty batch") {
+        auto result = reflector::reduce_fields<metric_t>(batch.subspan(0, 0));
+        REQUIRE(supertuple::get<0>(result).count == 0);
+        REQUIRE(supertuple::get<0>(result).sum == 0);
+    }
+}
@@ -0,0 +1,146 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the registry of heterogeneous records.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/registry.hpp>
+
+namespace
+{
+    struct quote_t {
+        uint32_t symbol;
+        double bid, ask;
+    };
+
+    struct trade_t {
+        uint32_t symbol;
+        int16_t size;
+        char side;
+    };
+
+    struct halt_t {
+        uint64_t until;
+    };
+}
+
+using registry_t = reflector::registry_t<quote_t, trade_t, halt_t>;
+
+/**
+ * Checks whether the registered types' members are gathered into the arena.
+ * @since 1.0
+ */
+TEST_CASE("gathering registered types into the arena", "[registry]")
+{
+    static_assert(registry_t::tag_v<quote_t> == 0);
+    static_assert(registry_t::tag_v<halt_t> == 2);
+    static_assert(registry_t::first_of[1] == 3);
+    static_assert(registry_t::first_of[3] == 7);
+    static_assert(registry_t::offsets[2] == offsetof(quote_t, ask));
+    static_assert(registry_t::offsets[5] == offsetof(trade_t, side));
+    static_assert(registry_t::frame_sizes[1] == registry_t::header_size + 8);
+
+    auto fields = registry_t::fields(registry_t::tag_v<trade_t>);
+
+    REQUIRE(fields.size() == 3);
+    REQUIRE(fields[1] == offsetof(trade_t, size));
+}
+
+/**
+ * Checks whether batches of heterogeneous records are visited.
+ * @since 1.0
+ */
+TEST_CASE("visiting batches of heterogeneous records", "[registry]")
+{
+    alignas(registry_t::alignment) std::byte batch[256];
+    std::byte *end = batch;
+
+    end = registry_t::write(end, quote_t {7, 10.5, 11.0});
+    end = registry_t::write(end, trade_t {7, 300, 'b'});
+    end = registry_t::write(end, halt_t {1000});
+    end = registry_t::write(end, trade_t {9, -20, 's'});
+
+    struct visitor_t {
+        double spread = 0;
+        int64_t volume = 0;
+        uint64_t halted = 0;
+        void operator()(quote_t& q) { spread += q.ask - q.bid; }
+        void operator()(trade_t& t) { volume += t.size; }
+        void operator()(halt_t& h)  { halted = h.until; }
+    } visitor;
+
+    REQUIRE(registry_t::for_each(batch, end, visitor) == end);
+    REQUIRE(visitor.spread == 0.5);
+    REQUIRE(visitor.volume == 280);
+    REQUIRE(visitor.halted == 1000);
+
+    size_t fields = 0;
+    const std::byte *cbatch = batch;
+
+    registry_t::visit_fields(1, cbatch + registry_t::header_size + registry_t::frame_sizes[0]
+      , [&fields](const auto&) { ++fields; });
+
+    REQUIRE(fields == 3);
+
+    registry_t::visit_fields(1, batch + registry_t::header_size + registry_t::frame_sizes[0]
+      , [](auto& member) { member += 1; });
+
+    trade_t trade;
+    std::memcpy(&trade, batch + registry_t::header_size + registry_t::frame_sizes[0], sizeof(trade_t));
+
+    REQUIRE(trade.symbol == 8);
+    REQUIRE(trade.size == 301);
+    REQUIRE(trade.side == 'c');
+    REQUIRE(registry_t::for_each(batch, end - 1, visitor) == end - registry_t::frame_sizes[1]);
+}
+
+/**
+ * Checks whether visitors returning references to the visited records are dispatched.
+ * @since 1.0
+ */
+TEST_CASE("visiting records with visitors returning references", "[registry]")
+{
+    using pair_registry_t = reflector::registry_t<quote_t, halt_t>;
+
+    alignas(pair_registry_t::alignment) std::byte batch[64];
+    pair_registry_t::write(batch, halt_t {500});
+
+    struct visitor_t {
+        uint64_t fallback = 0;
+        uint64_t& operator()(quote_t&) { return fallback; }
+        uint64_t& operator()(halt_t& h) { return h.until; }
+    } visitor;
+
+    uint64_t& until = pair_registry_t::visit(1, batch + pair_registry_t::header_size, visitor);
+    until = 600;
+
+    halt_t halt;
+    std::memcpy(&halt, batch + pair_registry_t::header_size, sizeof(halt_t));
+    REQUIRE(halt.until == 600);
+}
+
+/**
+ * Checks whether the padding bytes of written record frames are zeroed.
+ * @since 1.0
+ */
+TEST_CASE("zeroing the padding of written record frames", "[registry]")
+{
+    alignas(registry_t::alignment) std::byte batch[64];
+    std::memset(batch, 0xff, sizeof(batch));
+
+    const size_t frame = registry_t::frame_sizes[registry_t::tag_v<trade_t>];
+    REQUIRE(registry_t::write(batch, trade_t {1, 2, 'x'}) == batch + frame);
+
+    for (size_t i = sizeof(registry_t::tag_t); i < registry_t::header_size; ++i)
+        REQUIRE(batch[i] == std::byte {0});
+    for (size_t i = registry_t::header_size + sizeof(trade_t); i < frame; ++i)
+        REQUIRE(batch[i] == std::byte {0});
+
+    REQUIRE(batch[frame] == std::byte {0xff});
+}
@@ -0,0 +1,98 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the sequence lock snapshots.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/seqlock.hpp>
+
+namespace
+{
+    struct book_t {
+        uint64_t bid;
+        uint64_t ask;
+        uint64_t volume;
+    };
+
+    struct ticker_t {
+        uint32_t symbol;
+        double last;
+        char venue;
+    };
+
+    struct quote_t {
+        uint8_t side;
+        ticker_t ticker;
+        uint16_t levels[3];
+    };
+}
+
+/**
+ * Checks whether snapshots of padding-free types are taken word by word.
+ * @since 1.0
+ */
+TEST_CASE("taking snapshots of types without padding", "[seqlock]")
+{
+    static_assert(reflector::detail::wordwise_v<book_t>);
+
+    reflector::seqlock_t<book_t> lock (book_t {100, 101, 5});
+    REQUIRE(lock.version() == 0);
+
+    auto snapshot = lock.load();
+    REQUIRE(snapshot.bid == 100);
+    REQUIRE(snapshot.volume == 5);
+
+    lock.store({99, 102, 8});
+    REQUIRE(lock.version() == 1);
+
+    book_t copy {};
+    REQUIRE(lock.try_load(copy));
+    REQUIRE(copy.ask == 102);
+    REQUIRE(copy.volume == 8);
+}
+
+/**
+ * Checks whether snapshots of types with padding are taken member by member.
+ * @since 1.0
+ */
+TEST_CASE("taking snapshots of types with padding", "[seqlock]")
+{
+    static_assert(!reflector::detail::wordwise_v<ticker_t>);
+
+    reflector::seqlock_t<ticker_t> lock;
+    lock.store({42, 13.5, 'N'});
+    lock.store({42, 14.0, 'Q'});
+
+    auto snapshot = lock.load();
+
+    REQUIRE(lock.version() == 2);
+    REQUIRE(snapshot.symbol == 42);
+    REQUIRE(snapshot.last == 14.0);
+    REQUIRE(snapshot.venue == 'Q');
+}
+
+/**
+ * Checks whether snapshots of types with nested padded members are taken leaf by leaf.
+ * @since 1.0
+ */
+TEST_CASE("taking snapshots of types with nested members", "[seqlock]")
+{
+    static_assert(!reflector::detail::wordwise_v<quote_t>);
+
+    reflector::seqlock_t<quote_t> lock (quote_t {1, {7, 2.5, 'A'}, {10, 20, 30}});
+    lock.store({2, {8, 3.25, 'B'}, {40, 50, 60}});
+
+    auto snapshot = lock.load();
+
+    REQUIRE(lock.version() == 1);
+    REQUIRE(snapshot.side == 2);
+    REQUIRE(snapshot.ticker.symbol == 8);
+    REQUIRE(snapshot.ticker.last == 3.25);
+    REQUIRE(snapshot.ticker.venue == 'B');
+    REQUIRE(snapshot.levels[0] == 40);
+    REQUIRE(snapshot.levels[2] == 60);
+}
@@ -0,0 +1,111 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the binary serializer.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/serializer.hpp>
+
+struct packed_t {
+    int32_t a;
+    int32_t b;
+    int16_t c[2];
+};
+
+struct holed_t {
+    uint8_t a;
+    uint32_t b;
+    uint16_t c;
+    uint16_t d;
+    uint64_t e;
+};
+
+struct nested_t {
+    holed_t inner;
+    uint8_t tail;
+};
+
+/**
+ * Checks whether types without padding are serialized as a single block.
+ * @since 1.0
+ */
+TEST_CASE("serializing types without padding", "[serializer]")
+{
+    using descriptor_t = reflector::reflection_t<packed_t>::descriptor_t;
+
+    static_assert(!descriptor_t::has_padding);
+    static_assert(descriptor_t::runs.size() == 1);
+    static_assert(reflector::serialized_size_v<packed_t> == sizeof(packed_t));
+
+    auto source = packed_t {1, 2, {3, 4}};
+    std::byte buffer[sizeof(packed_t)];
+
+    REQUIRE(reflector::serialize(source, buffer) == buffer + sizeof(packed_t));
+    REQUIRE(std::memcmp(buffer, &source, sizeof(packed_t)) == 0);
+
+    packed_t target {};
+    REQUIRE(reflector::deserialize(buffer, target) == buffer + sizeof(packed_t));
+    REQUIRE(target.b == 2);
+    REQUIRE(target.c[1] == 4);
+}
+
+/**
+ * Checks whether padding bytes are skipped when serializing types.
+ * @since 1.0
+ */
+TEST_CASE("serializing types with padding", "[serializer]")
+{
+    using descriptor_t = reflector::reflection_t<holed_t>::descriptor_t;
+
+    static_assert(descriptor_t::has_padding);
+    static_assert(descriptor_t::runs.size() == 3);
+    static_assert(descriptor_t::runs[1].offset == offsetof(holed_t, b));
+    static_assert(descriptor_t::runs[1].position == 1);
+    static_assert(descriptor_t::runs[1].length == 8);
+    static_assert(reflector::serialized_size_v<holed_t> == 17);
+
+    auto source = holed_t {0xAA, 0x11223344, 0x5566, 0x7788, 0x99};
+    std::byte buffer[17];
+
+    REQUIRE(reflector::serialize(source, buffer) == buffer + 17);
+    REQUIRE(buffer[0] == std::byte{0xAA});
+    REQUIRE(std::memcmp(buffer + 1, &source.b, 4) == 0);
+    REQUIRE(std::memcmp(buffer + 9, &source.e, 8) == 0);
+
+    holed_t target {};
+    reflector::deserialize(buffer, target);
+
+    REQUIRE(target.a == source.a);
+    REQUIRE(target.b == source.b);
+    REQUIRE(target.c == source.c);
+    REQUIRE(target.d == source.d);
+    REQUIRE(target.e == source.e);
+}
+
+/**
+ * Checks whether the padding within nested members is also left out.
+ * @since 1.0
+ */
+TEST_CASE("serializing types with nested padding", "[serializer]")
+{
+    static_assert(reflector::serialized_size_v<nested_t> == 18);
+
+    auto source = nested_t {{0x01, 0x02030405, 0x0607, 0x0809, 0x0A0B0C0D0E0F1011}, 0x12};
+    std::byte buffer[18];
+
+    REQUIRE(reflector::serialize(source, buffer) == buffer + 18);
+    REQUIRE(buffer[17] == std::byte{0x12});
+
+    nested_t target {};
+    reflector::deserialize(buffer, target);
+
+    REQUIRE(target.inner.b == source.inner.b);
+    REQUIRE(target.inner.e == source.inner.e);
+    REQUIRE(target.tail == source.tail);
+}
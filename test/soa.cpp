@@ -0,0 +1,97 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the struct-of-arrays container.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <type_traits>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/soa.hpp>
+#include <supertuple.h>
+
+struct sample_t {
+    int32_t id;
+    double value;
+    char flag;
+};
+
+/**
+ * Checks whether instances are correctly transposed into the container's columns.
+ * @since 1.0
+ */
+TEST_CASE("struct-of-arrays container transposes instances", "[soa]")
+{
+    reflector::soa_vector_t<sample_t> soa;
+
+    soa.reserve(3);
+    soa.push_back({1, 1.5, 'a'});
+    soa.push_back({2, 2.5, 'b'});
+    soa.push_back({3, 3.5, 'c'});
+
+    REQUIRE(soa.size() == 3);
+    REQUIRE(!soa.empty());
+
+    auto ids = soa.column<0>();
+    auto values = soa.column<1>();
+
+    REQUIRE(ids.size() == 3);
+    REQUIRE(ids[0] == 1);
+    REQUIRE(ids[2] == 3);
+    REQUIRE(values[1] == 2.5);
+    REQUIRE(values.data() + 1 == &values[1]);
+
+    auto [id, value, flag] = soa[1];
+
+    REQUIRE(id == 2);
+    REQUIRE(value == 2.5);
+    REQUIRE(flag == 'b');
+
+    auto row = soa[2];
+    supertuple::set<1>(row, -1.0);
+    id = 20;
+
+    REQUIRE(soa.column<1>()[2] == -1.0);
+    REQUIRE(soa.column<0>()[1] == 20);
+
+    soa.clear();
+    REQUIRE(soa.empty());
+}
+
+struct toggle_t {
+    int32_t id;
+    bool active;
+};
+
+/**
+ * Checks whether boolean members are stored in contiguous, referenceable columns.
+ * @since 1.0
+ */
+TEST_CASE("struct-of-arrays container stores boolean members", "[soa]")
+{
+    reflector::soa_vector_t<toggle_t> soa;
+
+    soa.push_back({1, true});
+    soa.push_back({2, false});
+    soa.resize(3);
+
+    auto active = soa.column<1>();
+    static_assert(std::is_same_v<decltype(active), reflector::span_t<reflector::detail::boolean_t>>);
+
+    REQUIRE(active.size() == 3);
+    REQUIRE(active[0] == true);
+    REQUIRE(active[1] == false);
+    REQUIRE(active[2] == false);
+    REQUIRE(active.data() + 1 == &active[1]);
+
+    auto [id, flag] = soa[1];
+    flag = true;
+
+    REQUIRE(id == 2);
+    REQUIRE(soa.column<1>()[1] == true);
+
+    const auto& view = soa;
+    REQUIRE(supertuple::get<1>(view[0]) == true);
+}
@@ -0,0 +1,67 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the sort keys and radix sort.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/sort.hpp>
+
+struct entry_t {
+    int16_t group;
+    float score;
+    uint16_t id;
+};
+
+/**
+ * Checks whether sort keys preserve the order of the selected members.
+ * @since 1.0
+ */
+TEST_CASE("extracting order-preserving sort keys", "[sort]")
+{
+    using key_t = reflector::sort_key_t<entry_t, 0, 1, 2>;
+    static_assert(std::is_same_v<key_t::key_t, uint64_t>);
+    static_assert(std::is_same_v<reflector::sort_key_t<entry_t, 2>::key_t, uint16_t>);
+
+    const std::vector<entry_t> ordered = {
+        {-300, 2.5f, 1}, {-1, -1e10f, 0}, {-1, -0.5f, 9}, {0, -0.0f, 0}
+      , {0, 0.25f, 3}, {0, 0.25f, 4}, {5, 1e-3f, 2}, {5, 7.0f, 0}
+    };
+
+    key_t key;
+
+    for (size_t i = 1; i < ordered.size(); ++i) {
+        REQUIRE(key(ordered[i - 1]) < key(ordered[i]));
+        REQUIRE(key.compare(ordered[i - 1], ordered[i]));
+    }
+}
+
+/**
+ * Checks whether batches are stably sorted by their sort keys.
+ * @since 1.0
+ */
+TEST_CASE("radix sorting batches by sort keys", "[sort]")
+{
+    std::vector<entry_t> entries;
+
+    for (uint16_t i = 0; i < 500; ++i)
+        entries.push_back({int16_t((i * 37) % 11 - 5), float((i * 13) % 7) - 3.f, i});
+
+    auto expected = entries;
+    std::stable_sort(expected.begin(), expected.end(), [](const entry_t& a, const entry_t& b) {
+        return a.group != b.group ? a.group < b.group : a.score < b.score;
+    });
+
+    reflector::radix_sort(reflector::span_t(entries), reflector::sort_key_t<entry_t, 0, 1>());
+
+    for (size_t i = 0; i < entries.size(); ++i) {
+        REQUIRE(entries[i].group == expected[i].group);
+        REQUIRE(entries[i].score == expected[i].score);
+        REQUIRE(entries[i].id == expected[i].id);
+    }
+}
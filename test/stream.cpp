@@ -0,0 +1,102 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the batched streaming of records.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+#include <unistd.h>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/stream.hpp>
+
+namespace
+{
+    struct record_t {
+        uint32_t id;
+        double value;
+        uint8_t flag;
+    };
+
+    /**
+     * Reads all records from a file with a given stream mode and checks their contents.
+     * @param fd The file descriptor to read the records from.
+     * @param mode The mode to read the records with.
+     * @param total The number of records expected within the file.
+     */
+    void check_records(int fd, reflector::stream_mode_t mode, size_t total)
+    {
+        REQUIRE(::lseek(fd, 0, SEEK_SET) == 0);
+        reflector::record_stream_t<record_t> stream (fd, mode, 64);
+
+        size_t count = 0, batches = 0;
+
+        for (auto batch = stream.next(); !batch.empty(); batch = stream.next(), ++batches) {
+            REQUIRE(batch.size() <= 64);
+            for (auto record : batch) {
+                REQUIRE(record.aligned());
+                REQUIRE(record.get<0>() == count);
+                REQUIRE(record.load<1>() == count * 0.5);
+                REQUIRE(record.get<2>() == count % 2);
+                ++count;
+            }
+        }
+
+        REQUIRE(stream.error() == 0);
+        REQUIRE(batches == (total + 63) / 64);
+        REQUIRE(count == total);
+    }
+}
+
+/**
+ * Checks whether records can be written to and read back from a file in batches.
+ * @since 1.0
+ */
+TEST_CASE("streaming records through a file descriptor", "[stream]")
+{
+    char path[] = "/tmp/reflector-stream-XXXXXX";
+    int fd = ::mkstemp(path);
+    REQUIRE(fd >= 0);
+    ::unlink(path);
+
+    std::vector<record_t> records (300);
+
+    for (uint32_t i = 0; i < records.size(); ++i)
+        records[i] = record_t {i, i * 0.5, uint8_t(i % 2)};
+
+    {
+        reflector::record_stream_t<record_t> stream (fd, reflector::stream_mode_t::buffered, 64);
+
+        for (size_t i = 0; i < 10; ++i)
+            REQUIRE(stream.write(records[i]));
+
+        REQUIRE(stream.write(reflector::span_t(records.data() + 10, 40)));
+        REQUIRE(stream.write(reflector::span_t(records.data() + 50, 250)));
+        REQUIRE(stream.flush());
+        REQUIRE(stream.error() == 0);
+    }
+
+    REQUIRE(::lseek(fd, 0, SEEK_END) == off_t(300 * sizeof(record_t)));
+
+    SECTION("reading records into a buffer") {
+        check_records(fd, reflector::stream_mode_t::buffered, 300);
+    }
+
+    SECTION("reading records with prefetching") {
+        check_records(fd, reflector::stream_mode_t::prefetched, 300);
+    }
+
+    SECTION("reading records from the mapped file") {
+        check_records(fd, reflector::stream_mode_t::mapped, 300);
+    }
+
+    SECTION("ignoring a trailing partially written record") {
+        REQUIRE(::ftruncate(fd, 300 * sizeof(record_t) - 1) == 0);
+        check_records(fd, reflector::stream_mode_t::buffered, 299);
+    }
+
+    ::close(fd);
+}
@@ -0,0 +1,115 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the tagged union reflection.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/tagged.hpp>
+
+struct login_t {
+    uint32_t user;
+    uint8_t level;
+};
+
+struct move_t {
+    int16_t dx, dy;
+};
+
+struct event_t {
+    uint8_t kind;
+    union {
+        login_t login;
+        move_t move;
+        double timeout;
+    } as;
+};
+
+REFLECTOR_DECLARE_TAGGED(event_t, &event_t::kind, &event_t::as, login_t, move_t, double)
+
+/**
+ * Checks whether the active alternative of a tagged union is visited.
+ * @since 1.0
+ */
+TEST_CASE("visiting the active alternative of tagged unions", "[tagged]")
+{
+    using provider_t = reflector::tagged_provider_t<event_t>;
+
+    static_assert(reflector::is_tagged_v<event_t>);
+    static_assert(!reflector::is_tagged_v<login_t>);
+    static_assert(provider_t::count == 3);
+
+    event_t event {};
+    provider_t::select<1>(event, move_t {3, -4});
+
+    int16_t sum = 0;
+    size_t fields = 0;
+
+    REQUIRE(event.kind == 1);
+    REQUIRE(reflector::visit_alternative(event, [&](auto& alternative) {
+        if constexpr (std::is_same_v<std::decay_t<decltype(alternative)>, move_t>)
+            sum = alternative.dx + alternative.dy;
+    }));
+    REQUIRE(sum == -1);
+
+    size_t index = 0;
+    REQUIRE(provider_t::visit(event, [&](auto&, auto active) { index = active; }));
+    REQUIRE(index == 1);
+
+    const event_t& view = event;
+    REQUIRE(reflector::visit_tagged_fields(view, [&](const auto&) { ++fields; }));
+    REQUIRE(fields == 3);
+
+    event.kind = 7;
+    REQUIRE(!reflector::visit_alternative(event, [](auto&) {}));
+}
+
+/**
+ * Checks whether tagged unions are serialized and hashed by their active alternative.
+ * @since 1.0
+ */
+TEST_CASE("serializing and hashing tagged unions", "[tagged]")
+{
+    using provider_t = reflector::tagged_provider_t<event_t>;
+
+    event_t a, b;
+    std::memset(&a, 0xAA, sizeof(event_t));
+    std::memset(&b, 0x55, sizeof(event_t));
+    provider_t::select<0>(a, login_t {42, 3});
+    provider_t::select<0>(b, login_t {42, 3});
+
+    REQUIRE(reflector::hash_t<event_t>()(a) == reflector::hash_t<event_t>()(b));
+    REQUIRE(reflector::equal_to_t<event_t>()(a, b));
+
+    provider_t::select<2>(b, 1.5);
+    REQUIRE(!reflector::equal_to_t<event_t>()(a, b));
+
+    std::byte buffer[16];
+    REQUIRE(reflector::tagged_serialized_size(a) == 6);
+    REQUIRE(reflector::serialize_tagged(a, buffer) == buffer + 6);
+
+    event_t c {};
+    REQUIRE(reflector::deserialize_tagged(buffer, c) == buffer + 6);
+    REQUIRE(c.kind == 0);
+    REQUIRE(c.as.login.user == 42);
+    REQUIRE(c.as.login.level == 3);
+
+    REQUIRE(reflector::serialize_tagged(b, buffer) == buffer + 9);
+    REQUIRE(reflector::deserialize_tagged(buffer, c) == buffer + 9);
+    REQUIRE(c.as.timeout == 1.5);
+
+    buffer[0] = std::byte {9};
+    REQUIRE(reflector::deserialize_tagged(buffer, c) == nullptr);
+    REQUIRE(c.kind == 2);
+    REQUIRE(c.as.timeout == 1.5);
+
+    c.kind = 7;
+    REQUIRE(reflector::serialize_tagged(c, buffer) == nullptr);
+    REQUIRE(buffer[0] == std::byte {9});
+}
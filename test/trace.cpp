@@ -0,0 +1,70 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the instrumentation of reflected types.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <string_view>
+
+#include <catch.hpp>
+#include <reflector.h>
+
+namespace
+{
+    struct traced_t {
+        uint8_t flag;
+        uint32_t count;
+        double ratio;
+    };
+
+    size_t sampled = 0;
+    size_t last = 0;
+
+    void sample(const reflector::trace_record_t&, size_t field)
+    {
+        ++sampled;
+        last = field;
+    }
+}
+
+/**
+ * Checks whether reflected types are registered and their accesses are counted.
+ * @since 1.0
+ */
+TEST_CASE("tracing the usage of reflected types", "[trace]")
+{
+    static_assert(REFLECTOR_TRACE_ENABLED);
+
+    traced_t value {1, 2, 0.5};
+    auto reflection = reflector::reflection_t(value);
+    (void) reflection;
+
+    reflector::set_trace_hook(sample, 2);
+
+    for (int i = 0; i < 4; ++i)
+        reflector::reflection_t<traced_t>::member<1>(value) += 1;
+    reflector::reflection_t<traced_t>::member<2>(value) = 1.0;
+
+    reflector::set_trace_hook(nullptr);
+    reflector::reflection_t<traced_t>::member<2>(value) = 2.0;
+
+    const reflector::trace_record_t *record = nullptr;
+
+    reflector::for_each_trace([&record](const reflector::trace_record_t& current) {
+        if (current.name.find("traced_t") != std::string_view::npos)
+            record = &current;
+    });
+
+    REQUIRE(record != nullptr);
+    REQUIRE(record->count == 3);
+    REQUIRE(record->size == sizeof(traced_t));
+    REQUIRE(record->padding == 3);
+    REQUIRE(record->instances == 1);
+    REQUIRE(record->accesses[0] == 0);
+    REQUIRE(record->accesses[1] == 4);
+    REQUIRE(record->accesses[2] == 2);
+    REQUIRE(sampled == 3);
+    REQUIRE(last == 2);
+    REQUIRE(value.count == 6);
+}
@@ -0,0 +1,113 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the lazy reflection view.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstddef>
+#include <cstring>
+
+#include <catch.hpp>
+#include <reflector.h>
+
+struct record_t {
+    int id;
+    double value;
+    char tag[2];
+};
+
+/**
+ * Checks whether a view resolves its members on demand and can be deconstructed.
+ * @since 1.0
+ */
+TEST_CASE("reflection view resolves members lazily", "[view]")
+{
+    auto record = record_t {7, 3.5, {'a', 'b'}};
+    auto view = reflector::reflection_view_t(record);
+
+    static_assert(sizeof(view) == sizeof(record_t*));
+    static_assert(std::tuple_size_v<decltype(view)> == 4);
+
+    auto& [id, value, t0, t1] = view;
+
+    REQUIRE(id == 7);
+    REQUIRE(value == 3.5);
+    REQUIRE(t0 == 'a');
+    REQUIRE(t1 == 'b');
+
+    id = 10;
+    view.get<3>() = 'z';
+
+    REQUIRE(record.id == 10);
+    REQUIRE(record.tag[1] == 'z');
+}
+
+/**
+ * Checks whether a view over a constant instance propagates its constness.
+ * @since 1.0
+ */
+TEST_CASE("reflection view over constant instances", "[view]")
+{
+    const auto record = record_t {1, 2.0, {'x', 'y'}};
+    auto view = reflector::reflection_view_t(record);
+
+    static_assert(std::is_same_v<decltype(view.get<1>()), const double&>);
+
+    auto [id, value, t0, t1] = view;
+
+    REQUIRE(id == 1);
+    REQUIRE(value == 2.0);
+    REQUIRE(&view.target() == &record);
+}
+
+/**
+ * Checks whether a raw buffer can be reflected over without constructing an instance.
+ * @since 1.0
+ */
+TEST_CASE("overlay reflection over raw buffers", "[view]")
+{
+    using reflection_t = reflector::reflection_t<record_t>;
+
+    alignas(record_t) std::byte buffer[sizeof(record_t)] = {};
+    auto overlay = reflection_t::over(buffer);
+
+    REQUIRE(overlay.aligned());
+
+    auto& [id, value, t0, t1] = overlay;
+    id = 42;
+    value = 8.5;
+    t1 = 'q';
+
+    REQUIRE(overlay.load<0>() == 42);
+    REQUIRE(overlay.load<1>() == 8.5);
+
+    const std::byte *view = buffer;
+    auto coverlay = reflection_t::over(view);
+
+    static_assert(std::is_same_v<decltype(coverlay.get<0>()), const int&>);
+    REQUIRE(coverlay.get<3>() == 'q');
+}
+
+/**
+ * Checks whether unaligned buffers can be safely reflected over.
+ * @since 1.0
+ */
+TEST_CASE("overlay reflection over unaligned buffers", "[view]")
+{
+    using reflection_t = reflector::reflection_t<record_t>;
+
+    alignas(record_t) std::byte storage[sizeof(record_t) + 1] = {};
+    auto overlay = reflection_t::over(storage + 1);
+
+    REQUIRE(!overlay.aligned());
+
+    overlay.store<0>(-7);
+    overlay.store<1>(1.25);
+
+    REQUIRE(overlay.load<0>() == -7);
+    REQUIRE(overlay.load<1>() == 1.25);
+
+    int id;
+    std::memcpy(&id, storage + 1 + reflection_t::offset<0>(), sizeof(int));
+    REQUIRE(id == -7);
+}
@@ -0,0 +1,70 @@
+/**
+ * Reflector: A simple struct reflection framework for C++17.
+ * @file Test cases for the run-time member visitor dispatch.
+ * @author Rodrigo Siqueira <rodriados@gmail.com>
+ * @copyright 2024-present Rodrigo Siqueira
+ */
+#include <cstdint>
+#include <type_traits>
+
+#include <catch.hpp>
+#include <reflector.h>
+#include <reflector/visit.hpp>
+
+struct setting_t {
+    int32_t level;
+    double ratio;
+    char mode;
+    int16_t limits[2];
+};
+
+struct triple_t {
+    int x, y, z;
+};
+
+/**
+ * Checks whether visitors are dispatched to the member with the runtime index.
+ * @since 1.0
+ */
+TEST_CASE("visiting members chosen at run-time", "[visit]")
+{
+    setting_t setting {1, 0.5, 'x', {3, 4}};
+
+    for (size_t i = 0; i < reflector::reflection_t<setting_t>::count; ++i)
+        reflector::visit_member(setting, i, [](auto& member) { member += 1; });
+
+    REQUIRE(setting.level == 2);
+    REQUIRE(setting.ratio == 1.5);
+    REQUIRE(setting.mode == 'y');
+    REQUIRE(setting.limits[0] == 4);
+    REQUIRE(setting.limits[1] == 5);
+
+    const setting_t& view = setting;
+
+    auto size = reflector::visit_member(view, 4, [](auto& member) {
+        static_assert(std::is_const_v<std::remove_reference_t<decltype(member)>>);
+        return sizeof(member);
+    });
+
+    auto value = reflector::visit_member(view, 1, [](const auto& member) {
+        return static_cast<double>(member);
+    });
+
+    REQUIRE(size == sizeof(int16_t));
+    REQUIRE(value == 1.5);
+}
+
+/**
+ * Checks whether visitors returning references to the visited members are dispatched.
+ * @since 1.0
+ */
+TEST_CASE("visiting members with visitors returning references", "[visit]")
+{
+    triple_t triple {1, 2, 3};
+
+    int& member = reflector::visit_member(triple, 1, [](int& value) -> int& { return value; });
+    member = 7;
+
+    REQUIRE(triple.y == 7);
+    REQUIRE(&reflector::visit_member(triple, 2, [](int& value) -> int& { return value; }) == &triple.z);
+}